@@ -380,7 +380,7 @@ void FProjectAcousticsDebugRender::SetLoadedFilename(FString fileName)
 void FProjectAcousticsDebugRender::DrawStats()
 {
     FDebugMultiLinePrinter Panel(m_Canvas, FVector2D(20, 20));
-    Panel.DrawRect(FVector2D(-10, -5), FVector2D(500, -105), FColor(0, 0, 0, 128));
+    Panel.DrawRect(FVector2D(-10, -5), FVector2D(500, -125), FColor(0, 0, 0, 128));
     Panel.DrawText(FString::Printf(TEXT("[Acoustics Status]")), FColor::Green);
     // Panel.DrawText(FString::Printf(TEXT("Enabled : [%s]"), m_IsAcousticsEnabled ? TEXT("YES") : TEXT("NO")),
     // FColor::White);
@@ -407,6 +407,12 @@ void FProjectAcousticsDebugRender::DrawStats()
     Panel.DrawText(
         FString::Printf(TEXT("Outdoorness: [%d%%]"), static_cast<int>(m_Acoustics->GetOutdoorness() * 100.0f)),
         FColor::White);
+    Panel.DrawText(
+        FString::Printf(
+            TEXT("Query queue: [%d] across [%d] workers"),
+            m_Acoustics->GetQueryQueueDepth(),
+            m_Acoustics->GetNumQueryWorkers()),
+        FColor::White);
 }
 
 // Normal needs to point in an axis-aligned direction. Undefined behavior otherwise.
@@ -105,16 +105,17 @@ void UAcousticsDynamicOpening::BeginPlay()
         tritonCenter = m_Acoustics->WorldPositionToTriton(transform.TransformPosition(Center));
         tritonNormal = m_Acoustics->WorldDirectionToTriton(transform.TransformVectorNoScale(Normal));
 
+        // Queued, and applied in the background. If Triton rejects the opening, the warning is logged then
         if (!m_Acoustics->AddDynamicOpening(this, tritonCenter, tritonNormal, tritonVerts))
         {
             UE_LOG(
                 LogAcousticsRuntime,
                 Warning,
-                TEXT("Dynamic opening [%s] failed to register with Acoustics. Disabled."),
+                TEXT("Dynamic opening [%s] couldn't be queued for Acoustics. Is an ACE file loaded?"),
                 *Name().ToString());
         }
 
-        m_Acoustics->UpdateDynamicOpening(this, DryAttenuationDb, WetAttenuationDb);
+        SendAttenuation();
     }
 }
 
@@ -158,10 +159,28 @@ void UAcousticsDynamicOpening::TickComponent(
     auto* world = GetWorld();
     if (world && world->IsGameWorld() && m_Acoustics && Vertices.Num() > 0)
     {
-        m_Acoustics->UpdateDynamicOpening(this, DryAttenuationDb, WetAttenuationDb);
+        SendAttenuation();
     }
 }
 
+void UAcousticsDynamicOpening::SendAttenuation()
+{
+    // Smaller changes than this aren't audible, and every update invalidates cached acoustic queries
+    constexpr float c_AttenuationEpsilonDb = 0.01f;
+    float appliedDryAttenuationDb = 0.0f;
+    float appliedWetAttenuationDb = 0.0f;
+    if (m_Acoustics->GetAppliedDynamicOpeningAttenuation(this, appliedDryAttenuationDb, appliedWetAttenuationDb) &&
+        FMath::IsNearlyEqual(DryAttenuationDb, appliedDryAttenuationDb, c_AttenuationEpsilonDb) &&
+        FMath::IsNearlyEqual(WetAttenuationDb, appliedWetAttenuationDb, c_AttenuationEpsilonDb))
+    {
+        return;
+    }
+
+    // Until Triton has applied it. Repeated sends before the next PostTick replace each other rather than pile up,
+    // and the background work skips values already applied
+    m_Acoustics->UpdateDynamicOpening(this, DryAttenuationDb, WetAttenuationDb);
+}
+
 #if WITH_EDITOR
 void UAcousticsDynamicOpening::PostEditChangeProperty(struct FPropertyChangedEvent& e)
 {
@@ -0,0 +1,350 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsMemoryTrace.h"
+
+#if ACOUSTICS_MEMORY_TRACING
+
+#include "IAcoustics.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    struct FTraceRecord
+    {
+        // Index of the write this slot holds, plus one. Written last, so readers can tell a finished record
+        volatile int64 Sequence;
+        uint64 Cycles;
+        uint64 Address;
+        uint64 Size;
+        uint16 Scope;
+        uint8 Op;
+        uint8 Alignment;
+    };
+
+    constexpr uint32 c_MemTraceMagic = 0x544D4150; // 'PAMT'
+    constexpr uint32 c_MemTraceVersion = 1;
+    constexpr int32 c_DefaultTraceCapacity = 256 * 1024;
+    constexpr int32 c_MaxScopeDepth = 16;
+    constexpr int32 c_NumLeakCandidatesLogged = 10;
+
+    FTraceRecord* s_Records = nullptr;
+    int64 s_Capacity = 0;
+    volatile int64 s_WriteIndex = 0;
+    // Writers between checking the recording flag and finishing their record. Stop waits for this to drain
+    volatile int32 s_NumWriters = 0;
+
+    // Scope names, by tag. Tag 0 is outside any scope
+    FCriticalSection s_ScopeLock;
+    TArray<FString> s_ScopeNames = {TEXT("(none)")};
+
+    thread_local uint16 t_ScopeStack[c_MaxScopeDepth];
+    thread_local int32 t_ScopeDepth = 0;
+
+    // Runs fn over every complete record, oldest first
+    template <typename FunctionType>
+    void ForEachRecord(FunctionType fn)
+    {
+        const int64 numWritten = FPlatformAtomics::AtomicRead(&s_WriteIndex);
+        for (int64 i = FMath::Max<int64>(0, numWritten - s_Capacity); i < numWritten; i++)
+        {
+            const FTraceRecord& record = s_Records[i & (s_Capacity - 1)];
+            if (record.Sequence == i + 1)
+            {
+                fn(record);
+            }
+        }
+    }
+
+    // Pauses recording for as long as it's in scope, so the ring can be read without writers racing us
+    struct FScopedTracePause
+    {
+        bool WasRecording;
+        FScopedTracePause() : WasRecording(FAcousticsMemoryTrace::IsRecording())
+        {
+            FAcousticsMemoryTrace::Stop();
+        }
+        ~FScopedTracePause()
+        {
+            if (WasRecording)
+            {
+                FAcousticsMemoryTrace::Start(0);
+            }
+        }
+    };
+} // namespace
+
+volatile int32 FAcousticsMemoryTrace::s_IsRecording = 0;
+
+void FAcousticsMemoryTrace::Start(int32 capacity)
+{
+    Stop();
+
+    // 0 keeps the current ring and everything in it
+    if (capacity > 0 || s_Records == nullptr)
+    {
+        const int64 newCapacity = FMath::RoundUpToPowerOfTwo(capacity > 0 ? capacity : c_DefaultTraceCapacity);
+        if (newCapacity != s_Capacity)
+        {
+            FMemory::Free(s_Records);
+            s_Records = static_cast<FTraceRecord*>(FMemory::Malloc(newCapacity * sizeof(FTraceRecord)));
+            s_Capacity = newCapacity;
+        }
+        FMemory::Memzero(s_Records, s_Capacity * sizeof(FTraceRecord));
+        s_WriteIndex = 0;
+    }
+
+    FPlatformMisc::MemoryBarrier();
+    FPlatformAtomics::InterlockedExchange(&s_IsRecording, 1);
+}
+
+void FAcousticsMemoryTrace::Stop()
+{
+    FPlatformAtomics::InterlockedExchange(&s_IsRecording, 0);
+    while (FPlatformAtomics::AtomicRead(&s_NumWriters) > 0)
+    {
+        FPlatformProcess::YieldThread();
+    }
+}
+
+void FAcousticsMemoryTrace::Record(const void* ptr, const size_t size, const uint32 alignment, const uint8 op)
+{
+    FPlatformAtomics::InterlockedIncrement(&s_NumWriters);
+    if (FPlatformAtomics::AtomicRead(&s_IsRecording) != 0)
+    {
+        const int64 index = FPlatformAtomics::InterlockedIncrement(&s_WriteIndex) - 1;
+        FTraceRecord& record = s_Records[index & (s_Capacity - 1)];
+        record.Sequence = 0;
+        FPlatformMisc::MemoryBarrier();
+        record.Cycles = FPlatformTime::Cycles64();
+        record.Address = reinterpret_cast<uint64>(ptr);
+        record.Size = size;
+        record.Scope = t_ScopeDepth > 0 ? t_ScopeStack[FMath::Min(t_ScopeDepth, c_MaxScopeDepth) - 1] : 0;
+        record.Op = op;
+        record.Alignment = static_cast<uint8>(FMath::Min<uint32>(alignment, MAX_uint8));
+        FPlatformMisc::MemoryBarrier();
+        FPlatformAtomics::AtomicStore(&record.Sequence, index + 1);
+    }
+    FPlatformAtomics::InterlockedDecrement(&s_NumWriters);
+}
+
+void FAcousticsMemoryTrace::PushScope(const wchar_t* name)
+{
+    // Triton's scope names are plain ASCII, and wchar_t isn't TCHAR on every platform
+    FString scopeName;
+    for (const wchar_t* c = name; c != nullptr && *c != 0; c++)
+    {
+        scopeName.AppendChar(static_cast<TCHAR>(*c));
+    }
+
+    uint16 tag = 0;
+    {
+        FScopeLock lock(&s_ScopeLock);
+        int32 index = s_ScopeNames.Find(scopeName);
+        if (index == INDEX_NONE && s_ScopeNames.Num() <= MAX_uint16)
+        {
+            index = s_ScopeNames.Add(scopeName);
+        }
+        tag = static_cast<uint16>(FMath::Max(index, 0));
+    }
+
+    // Deeper scopes than we have room for are attributed to the innermost one we kept
+    if (t_ScopeDepth < c_MaxScopeDepth)
+    {
+        t_ScopeStack[t_ScopeDepth] = tag;
+    }
+    t_ScopeDepth++;
+}
+
+void FAcousticsMemoryTrace::PopScope()
+{
+    t_ScopeDepth = FMath::Max(t_ScopeDepth - 1, 0);
+}
+
+void FAcousticsMemoryTrace::LogSummary()
+{
+    if (s_Records == nullptr)
+    {
+        UE_LOG(LogAcousticsRuntime, Display, TEXT("No memory trace recorded. Start one with PA.MemTrace.Start"));
+        return;
+    }
+
+    FScopedTracePause pause;
+
+    struct FLiveAllocation
+    {
+        uint64 Size;
+        uint64 Cycles;
+        uint16 Scope;
+    };
+    TMap<uint64, FLiveAllocation> live;
+    TArray<int64> scopeBytes;
+    TArray<int64> scopePeakBytes;
+    TArray<int32> scopeAllocations;
+    {
+        FScopeLock lock(&s_ScopeLock);
+        scopeBytes.SetNumZeroed(s_ScopeNames.Num());
+        scopePeakBytes.SetNumZeroed(s_ScopeNames.Num());
+        scopeAllocations.SetNumZeroed(s_ScopeNames.Num());
+    }
+
+    int64 numRecords = 0;
+    uint64 lastCycles = 0;
+    ForEachRecord(
+        [&](const FTraceRecord& record)
+        {
+            numRecords++;
+            lastCycles = record.Cycles;
+            if (record.Scope >= scopeBytes.Num())
+            {
+                return;
+            }
+            if (record.Op == 0)
+            {
+                live.Add(record.Address, {record.Size, record.Cycles, record.Scope});
+                scopeBytes[record.Scope] += record.Size;
+                scopeAllocations[record.Scope]++;
+                scopePeakBytes[record.Scope] = FMath::Max(scopePeakBytes[record.Scope], scopeBytes[record.Scope]);
+            }
+            else if (const FLiveAllocation* allocation = live.Find(record.Address))
+            {
+                // Frees of blocks allocated before the recorded window are ignored
+                scopeBytes[allocation->Scope] -= allocation->Size;
+                live.Remove(record.Address);
+            }
+        });
+
+    UE_LOG(
+        LogAcousticsRuntime,
+        Display,
+        TEXT("Triton memory trace: %lld records, %d allocations still live"),
+        numRecords,
+        live.Num());
+    UE_LOG(LogAcousticsRuntime, Display, TEXT("  Peak KB   Live KB   Allocs   Scope"));
+    {
+        FScopeLock lock(&s_ScopeLock);
+        for (int32 i = 0; i < scopeBytes.Num(); i++)
+        {
+            if (scopeAllocations[i] > 0)
+            {
+                UE_LOG(
+                    LogAcousticsRuntime,
+                    Display,
+                    TEXT("  %7lld   %7lld   %6d   %s"),
+                    scopePeakBytes[i] / 1024,
+                    scopeBytes[i] / 1024,
+                    scopeAllocations[i],
+                    *s_ScopeNames[i]);
+            }
+        }
+    }
+
+    // The largest allocations still live at the end of the window are the likeliest leaks
+    live.ValueSort([](const FLiveAllocation& a, const FLiveAllocation& b) { return a.Size > b.Size; });
+    UE_LOG(LogAcousticsRuntime, Display, TEXT("  Leak candidates:"));
+    int32 numLogged = 0;
+    for (const auto& pair : live)
+    {
+        if (numLogged++ == c_NumLeakCandidatesLogged)
+        {
+            break;
+        }
+        FScopeLock lock(&s_ScopeLock);
+        UE_LOG(
+            LogAcousticsRuntime,
+            Display,
+            TEXT("    0x%llx  %llu bytes  %.1f s old  %s"),
+            pair.Key,
+            pair.Value.Size,
+            FPlatformTime::ToSeconds64(lastCycles - pair.Value.Cycles),
+            *s_ScopeNames[pair.Value.Scope]);
+    }
+}
+
+bool FAcousticsMemoryTrace::Export(const FString& fileName)
+{
+    if (s_Records == nullptr)
+    {
+        return false;
+    }
+
+    TUniquePtr<FArchive> file(IFileManager::Get().CreateFileWriter(*fileName));
+    if (file == nullptr)
+    {
+        UE_LOG(LogAcousticsRuntime, Warning, TEXT("Failed to create memory trace file: [%s]"), *fileName);
+        return false;
+    }
+
+    FScopedTracePause pause;
+
+    uint32 magic = c_MemTraceMagic;
+    uint32 version = c_MemTraceVersion;
+    uint64 cyclesPerSecond = static_cast<uint64>(1.0 / FPlatformTime::GetSecondsPerCycle64());
+    *file << magic << version << cyclesPerSecond;
+    {
+        FScopeLock lock(&s_ScopeLock);
+        uint32 numScopes = static_cast<uint32>(s_ScopeNames.Num());
+        *file << numScopes;
+        for (const FString& scopeName : s_ScopeNames)
+        {
+            FTCHARToUTF8 name(*scopeName);
+            uint32 nameLength = static_cast<uint32>(name.Length());
+            *file << nameLength;
+            file->Serialize((void*) name.Get(), nameLength);
+        }
+    }
+
+    // Count first, so the header can say how many records follow
+    uint64 numRecords = 0;
+    ForEachRecord([&numRecords](const FTraceRecord&) { numRecords++; });
+    *file << numRecords;
+    ForEachRecord(
+        [&file](const FTraceRecord& record)
+        {
+            uint64 cycles = record.Cycles;
+            uint64 address = record.Address;
+            uint64 size = record.Size;
+            uint16 scope = record.Scope;
+            uint8 op = record.Op;
+            uint8 alignment = record.Alignment;
+            *file << cycles << address << size << scope << op << alignment;
+        });
+
+    UE_LOG(LogAcousticsRuntime, Display, TEXT("Wrote %llu memory trace records to [%s]"), numRecords, *fileName);
+    return file->Close();
+}
+
+static FAutoConsoleCommand CmdAcousticsMemTraceStart(
+    TEXT("PA.MemTrace.Start"),
+    TEXT("Start tracing Triton allocations. Optional argument: ring buffer capacity, in records"),
+    FConsoleCommandWithArgsDelegate::CreateLambda(
+        [](const TArray<FString>& args)
+        {
+            const int32 capacity = args.Num() > 0 ? FCString::Atoi(*args[0]) : c_DefaultTraceCapacity;
+            FAcousticsMemoryTrace::Start(FMath::Max(capacity, 1));
+        }));
+
+static FAutoConsoleCommand CmdAcousticsMemTraceStop(
+    TEXT("PA.MemTrace.Stop"),
+    TEXT("Stop tracing Triton allocations. What was recorded is kept for PA.MemTrace.Summary and Export"),
+    FConsoleCommandDelegate::CreateStatic(&FAcousticsMemoryTrace::Stop));
+
+static FAutoConsoleCommand CmdAcousticsMemTraceSummary(
+    TEXT("PA.MemTrace.Summary"),
+    TEXT("Log peak memory by Triton allocation scope, and leak candidates, from the memory trace"),
+    FConsoleCommandDelegate::CreateStatic(&FAcousticsMemoryTrace::LogSummary));
+
+static FAutoConsoleCommand CmdAcousticsMemTraceExport(
+    TEXT("PA.MemTrace.Export"),
+    TEXT("Write the memory trace to Saved/Acoustics"),
+    FConsoleCommandDelegate::CreateLambda(
+        []()
+        {
+            FAcousticsMemoryTrace::Export(
+                FPaths::ProjectSavedDir() / TEXT("Acoustics") /
+                FString::Printf(TEXT("MemTrace-%s.pamemtrace"), *FDateTime::Now().ToString()));
+        }));
+
+#endif // ACOUSTICS_MEMORY_TRACING
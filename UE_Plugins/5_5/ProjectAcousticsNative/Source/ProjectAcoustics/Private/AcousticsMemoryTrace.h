@@ -0,0 +1,72 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Define ACOUSTICS_MEMORY_TRACING=1 to be able to trace every allocation Triton makes. When it isn't defined the
+// tracing code is compiled out completely, and the memory hooks are exactly as they would be without it.
+#ifndef ACOUSTICS_MEMORY_TRACING
+#define ACOUSTICS_MEMORY_TRACING 0
+#endif
+
+#if ACOUSTICS_MEMORY_TRACING
+
+// Records Triton's allocations and frees into a fixed-size ring buffer, tagged with the allocation scope Triton
+// reported on the allocating thread. Writers claim a slot with a single atomic increment and never block each other.
+// Once the ring wraps, the oldest records are overwritten.
+// Driven from the console: PA.MemTrace.Start [capacity], PA.MemTrace.Stop, PA.MemTrace.Summary, PA.MemTrace.Export.
+//
+// Export format, all little-endian:
+//   Header:  uint32 Magic ('PAMT'), uint32 Version (1), uint64 timestamp cycles per second,
+//            uint32 NumScopes, then for each scope uint32 NameLength and NameLength bytes of UTF-8,
+//            uint64 NumRecords
+//   Records: uint64 timestamp cycles, uint64 address, uint64 size (0 for frees),
+//            uint16 scope index (0 = outside any scope), uint8 op (0 = alloc, 1 = free), uint8 alignment
+class FAcousticsMemoryTrace
+{
+public:
+    // Start recording into a ring of this many records, discarding anything recorded before
+    static void Start(int32 capacity);
+    static void Stop();
+
+    static bool IsRecording()
+    {
+        return FPlatformAtomics::AtomicRead_Relaxed(&s_IsRecording) != 0;
+    }
+
+    static void RecordAlloc(const void* ptr, const size_t size, const uint32 alignment)
+    {
+        if (IsRecording() && ptr != nullptr)
+        {
+            Record(ptr, size, alignment, 0);
+        }
+    }
+
+    static void RecordFree(const void* ptr)
+    {
+        if (IsRecording() && ptr != nullptr)
+        {
+            Record(ptr, 0, 0, 1);
+        }
+    }
+
+    // Triton's allocation scopes. Allocations on this thread are tagged with the innermost open scope
+    static void PushScope(const wchar_t* name);
+    static void PopScope();
+
+    // Logs peak live memory for each scope over the recorded window, and the largest allocations still live at
+    // the end of it, which are leak candidates
+    static void LogSummary();
+
+    // Writes what has been recorded so far to a file, in the format above
+    static bool Export(const FString& fileName);
+
+private:
+    static void Record(const void* ptr, const size_t size, const uint32 alignment, const uint8 op);
+
+    static volatile int32 s_IsRecording;
+};
+
+#endif // ACOUSTICS_MEMORY_TRACING
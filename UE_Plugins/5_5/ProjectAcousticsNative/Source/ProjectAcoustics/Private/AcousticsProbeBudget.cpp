@@ -0,0 +1,99 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsProbeBudget.h"
+
+DEFINE_STAT(STAT_Acoustics_PeakMemory);
+DEFINE_STAT(STAT_Acoustics_LoadedRegions);
+DEFINE_STAT(STAT_Acoustics_RegionsEvicted);
+
+FAcousticsProbeBudget::FAcousticsProbeBudget() : m_LastTouchFrame(INDEX_NONE), m_PeakBytes(0)
+{
+}
+
+void FAcousticsProbeBudget::OnRegionLoaded(
+    const FVector& center, const FVector& size, const bool unloadedOutside, const int32 frame)
+{
+    if (unloadedOutside)
+    {
+        m_Regions.Reset();
+    }
+
+    const FBox bounds = FBox::BuildAABB(center, size.GetAbs() * 0.5f);
+    // Loading the same region again just moves it to the back
+    m_Regions.RemoveAll([&bounds](const FRegion& region) { return region.Bounds == bounds; });
+    m_Regions.Add({bounds, frame});
+}
+
+void FAcousticsProbeBudget::Touch(const FVector& listenerLocation, const int32 frame)
+{
+    m_LastTouchFrame = frame;
+    for (FRegion& region : m_Regions)
+    {
+        if (region.Bounds.IsInsideOrOn(listenerLocation))
+        {
+            region.LastUsedFrame = frame;
+        }
+    }
+}
+
+bool FAcousticsProbeBudget::PopLeastRecentlyUsed(FVector& outCenter, FVector& outSize)
+{
+    if (m_Regions.Num() < 2)
+    {
+        return false;
+    }
+
+    // Unloading is by box, so a region overlapping one in use would take some of its probes with it
+    TArray<FBox, TInlineAllocator<8>> inUse;
+    for (int32 i = 0; i < m_Regions.Num(); i++)
+    {
+        if (IsInUse(i))
+        {
+            inUse.Add(m_Regions[i].Bounds);
+        }
+    }
+
+    int32 oldest = INDEX_NONE;
+    for (int32 i = 0; i < m_Regions.Num(); i++)
+    {
+        const FRegion& region = m_Regions[i];
+        if (IsInUse(i) || (oldest != INDEX_NONE && region.LastUsedFrame >= m_Regions[oldest].LastUsedFrame))
+        {
+            continue;
+        }
+        if (!inUse.ContainsByPredicate([&region](const FBox& bounds) { return region.Bounds.Intersect(bounds); }))
+        {
+            oldest = i;
+        }
+    }
+    if (oldest == INDEX_NONE)
+    {
+        return false;
+    }
+
+    outCenter = m_Regions[oldest].Bounds.GetCenter();
+    outSize = m_Regions[oldest].Bounds.GetSize();
+    m_Regions.RemoveAt(oldest);
+    INC_DWORD_STAT(STAT_Acoustics_RegionsEvicted);
+    return true;
+}
+
+bool FAcousticsProbeBudget::IsInUse(const int32 regionIndex) const
+{
+    return regionIndex == m_Regions.Num() - 1 ||
+           (m_LastTouchFrame != INDEX_NONE && m_Regions[regionIndex].LastUsedFrame >= m_LastTouchFrame);
+}
+
+void FAcousticsProbeBudget::UpdateStats(const int64 bytesUsed)
+{
+    m_PeakBytes = FMath::Max(m_PeakBytes, bytesUsed);
+    SET_MEMORY_STAT(STAT_Acoustics_PeakMemory, m_PeakBytes);
+    SET_DWORD_STAT(STAT_Acoustics_LoadedRegions, m_Regions.Num());
+}
+
+void FAcousticsProbeBudget::Reset()
+{
+    m_Regions.Reset();
+    m_LastTouchFrame = INDEX_NONE;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "IAcoustics.h"
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Acoustics Peak Memory Usage"), STAT_Acoustics_PeakMemory, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Loaded Regions"), STAT_Acoustics_LoadedRegions, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Regions Evicted"), STAT_Acoustics_RegionsEvicted, STATGROUP_Acoustics, );
+
+// Tracks the regions of probes that have been loaded, and when the listener was last inside each of them.
+// Triton interpolates between the probes around the listener, so a region the listener hasn't been in for a while
+// isn't being queried. When Triton's memory goes over budget, or loading another region would take it over, the least
+// recently used region is handed back to be unloaded. Only the game thread may use this.
+class FAcousticsProbeBudget
+{
+public:
+    FAcousticsProbeBudget();
+
+    // A region of probes was loaded. If everything outside it was unloaded at the same time, it replaces every
+    // region tracked so far
+    void OnRegionLoaded(const FVector& center, const FVector& size, const bool unloadedOutside, const int32 frame);
+
+    // The listener is at this location, so any region around it is in use
+    void Touch(const FVector& listenerLocation, const int32 frame);
+
+    // Remove and return the least recently used region that can be unloaded without touching any region still in
+    // use: the newest one, and those the listener was in at the last Touch. Returns false if there is no such region
+    bool PopLeastRecentlyUsed(FVector& outCenter, FVector& outSize);
+
+    // Publishes current and peak memory stats. Call once per frame with Triton's current memory use
+    void UpdateStats(const int64 bytesUsed);
+
+    void Reset();
+
+    int32 GetNumRegions() const
+    {
+        return m_Regions.Num();
+    }
+
+private:
+    struct FRegion
+    {
+        FBox Bounds;
+        int32 LastUsedFrame;
+    };
+
+    bool IsInUse(const int32 regionIndex) const;
+
+    // In load order, so the newest region is last
+    TArray<FRegion> m_Regions;
+    // Frame of the last Touch
+    int32 m_LastTouchFrame;
+    int64 m_PeakBytes;
+};
@@ -0,0 +1,198 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsQueryCache.h"
+
+DEFINE_STAT(STAT_Acoustics_QueryCacheHits);
+DEFINE_STAT(STAT_Acoustics_QueryCacheMisses);
+DEFINE_STAT(STAT_Acoustics_QueryCacheEntries);
+
+FAcousticsQueryCache::FAcousticsQueryCache()
+    : m_Head(INDEX_NONE)
+    , m_Tail(INDEX_NONE)
+    , m_Capacity(0)
+    , m_GridSize(0)
+    , m_InverseGridSize(0)
+    , m_IsEnabled(0)
+    , m_RegionGeneration(0)
+    , m_OpeningGeneration(0)
+{
+}
+
+void FAcousticsQueryCache::Configure(const bool enabled, const float gridSize, const int32 budgetBytes)
+{
+    // Rough cost of an entry, including its slot in the index
+    constexpr int32 bytesPerEntry = sizeof(FEntry) + sizeof(TPair<FKey, int32>) + 2 * sizeof(int32);
+    const int32 capacity = enabled ? FMath::Max(budgetBytes, 0) / bytesPerEntry : 0;
+    const float newGridSize = FMath::Max(gridSize, 1.0f);
+
+    if (enabled == IsEnabled() && capacity == m_Capacity && newGridSize == m_GridSize)
+    {
+        return;
+    }
+
+    FScopeLock lock(&m_Lock);
+    m_Capacity = capacity;
+    m_GridSize = newGridSize;
+    m_InverseGridSize = 1.0f / newGridSize;
+    m_Entries.Empty(m_Capacity);
+    m_Index.Empty(m_Capacity);
+    m_Head = INDEX_NONE;
+    m_Tail = INDEX_NONE;
+    FPlatformAtomics::AtomicStore(&m_IsEnabled, enabled && m_Capacity > 0 ? 1 : 0);
+    // Keys made before this are for the old grid. Make sure they're never stored or hit
+    FPlatformAtomics::InterlockedIncrement(&m_RegionGeneration);
+}
+
+FAcousticsQueryCache::FKey FAcousticsQueryCache::MakeKey(
+    const FVector& sourceLocation, const FVector& listenerLocation,
+    const TritonRuntime::InterpolationConfig& interpConfig, const bool applyDynamicOpenings) const
+{
+    FKey key;
+    key.Source = FIntVector(
+        FMath::FloorToInt(sourceLocation.X * m_InverseGridSize),
+        FMath::FloorToInt(sourceLocation.Y * m_InverseGridSize),
+        FMath::FloorToInt(sourceLocation.Z * m_InverseGridSize));
+    key.Listener = FIntVector(
+        FMath::FloorToInt(listenerLocation.X * m_InverseGridSize),
+        FMath::FloorToInt(listenerLocation.Y * m_InverseGridSize),
+        FMath::FloorToInt(listenerLocation.Z * m_InverseGridSize));
+    key.PushVector = interpConfig.PushVector;
+    key.Resolver = static_cast<uint8>(interpConfig.Resolver);
+    key.ApplyDynamicOpenings = applyDynamicOpenings;
+    key.RegionGeneration = FPlatformAtomics::AtomicRead(&m_RegionGeneration);
+    // Sources that ignore openings don't care when they change
+    key.OpeningGeneration = applyDynamicOpenings ? FPlatformAtomics::AtomicRead(&m_OpeningGeneration) : 0;
+    return key;
+}
+
+void FAcousticsQueryCache::Unlink(const int32 index)
+{
+    FEntry& entry = m_Entries[index];
+    if (entry.Prev != INDEX_NONE)
+    {
+        m_Entries[entry.Prev].Next = entry.Next;
+    }
+    else
+    {
+        m_Head = entry.Next;
+    }
+    if (entry.Next != INDEX_NONE)
+    {
+        m_Entries[entry.Next].Prev = entry.Prev;
+    }
+    else
+    {
+        m_Tail = entry.Prev;
+    }
+    entry.Prev = INDEX_NONE;
+    entry.Next = INDEX_NONE;
+}
+
+void FAcousticsQueryCache::LinkAtHead(const int32 index)
+{
+    FEntry& entry = m_Entries[index];
+    entry.Prev = INDEX_NONE;
+    entry.Next = m_Head;
+    if (m_Head != INDEX_NONE)
+    {
+        m_Entries[m_Head].Prev = index;
+    }
+    m_Head = index;
+    if (m_Tail == INDEX_NONE)
+    {
+        m_Tail = index;
+    }
+}
+
+bool FAcousticsQueryCache::Find(
+    const FVector& sourceLocation, const FVector& listenerLocation,
+    const TritonRuntime::InterpolationConfig& interpConfig, const bool applyDynamicOpenings,
+    TritonAcousticParameters& outParams, TritonDynamicOpeningInfo& outOpeningInfo, FKey& outKey)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    FScopeLock lock(&m_Lock);
+    // Check again now we hold the lock, in case Configure disabled the cache in between
+    if (!IsEnabled())
+    {
+        return false;
+    }
+    outKey = MakeKey(sourceLocation, listenerLocation, interpConfig, applyDynamicOpenings);
+    const FKey& key = outKey;
+    const int32* index = m_Index.Find(key);
+    if (index == nullptr)
+    {
+        INC_DWORD_STAT(STAT_Acoustics_QueryCacheMisses);
+        return false;
+    }
+
+    Unlink(*index);
+    LinkAtHead(*index);
+    outParams = m_Entries[*index].Params;
+    outOpeningInfo = m_Entries[*index].OpeningInfo;
+    INC_DWORD_STAT(STAT_Acoustics_QueryCacheHits);
+    return true;
+}
+
+void FAcousticsQueryCache::Add(
+    const FKey& key, const TritonAcousticParameters& params, const TritonDynamicOpeningInfo& openingInfo)
+{
+    // No key if the cache was disabled when the query was looked up
+    if (!IsEnabled() || key.RegionGeneration == INDEX_NONE)
+    {
+        return;
+    }
+
+    FScopeLock lock(&m_Lock);
+    // The key's generation is stale if Configure ran since Find, but the cache may also have been emptied to zero
+    // capacity. Don't try to re-use an entry that isn't there
+    if (!IsEnabled())
+    {
+        return;
+    }
+    int32 index = INDEX_NONE;
+    if (const int32* existing = m_Index.Find(key))
+    {
+        // Another thread got here first
+        index = *existing;
+        Unlink(index);
+    }
+    else if (m_Entries.Num() < m_Capacity)
+    {
+        index = m_Entries.AddUninitialized();
+        m_Index.Add(key, index);
+    }
+    else
+    {
+        // Full. Re-use the least recently used entry. Entries from older generations are never hit again, so they
+        // drift to the tail and get re-used first
+        index = m_Tail;
+        Unlink(index);
+        m_Index.Remove(m_Entries[index].Key);
+        m_Index.Add(key, index);
+    }
+
+    FEntry& entry = m_Entries[index];
+    entry.Key = key;
+    entry.Params = params;
+    entry.OpeningInfo = openingInfo;
+    LinkAtHead(index);
+}
+
+void FAcousticsQueryCache::Reset()
+{
+    FScopeLock lock(&m_Lock);
+    m_Entries.Reset();
+    m_Index.Reset();
+    m_Head = INDEX_NONE;
+    m_Tail = INDEX_NONE;
+}
+
+void FAcousticsQueryCache::UpdateStats()
+{
+    SET_DWORD_STAT(STAT_Acoustics_QueryCacheEntries, m_Entries.Num());
+}
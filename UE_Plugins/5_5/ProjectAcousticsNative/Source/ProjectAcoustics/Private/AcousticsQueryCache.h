@@ -0,0 +1,124 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "IAcoustics.h"
+#include "TritonPublicInterface.h"
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Acoustics Query Cache Hits"), STAT_Acoustics_QueryCacheHits, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Acoustics Query Cache Misses"), STAT_Acoustics_QueryCacheMisses, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Query Cache Entries"), STAT_Acoustics_QueryCacheEntries, STATGROUP_Acoustics, );
+
+// Caches successful acoustic queries, keyed on source and listener positions snapped to a grid.
+// Static emitters heard by a slow-moving listener end up asking Triton the same question frame after frame, and
+// can be answered from here instead. Entries are evicted least-recently-used once the byte budget is full.
+// Results are tagged with a region generation (bumped whenever probes are loaded or unloaded) and, for sources
+// that apply dynamic openings, an opening generation. Bumping either generation invalidates every matching entry
+// at once without touching the table.
+// Safe to use from any number of query threads.
+class FAcousticsQueryCache
+{
+public:
+    FAcousticsQueryCache();
+
+    // Enable or resize the cache. Clears it if the grid size or budget changes
+    void Configure(const bool enabled, const float gridSize, const int32 budgetBytes);
+
+    bool IsEnabled() const
+    {
+        return FPlatformAtomics::AtomicRead(&m_IsEnabled) != 0;
+    }
+
+    // Identifies a query: its grid cells and settings, and the generations current when it was looked up
+    struct FKey
+    {
+        FIntVector Source;
+        FIntVector Listener;
+        Triton::Vec3f PushVector;
+        // INDEX_NONE until the key has been made by Find
+        int32 RegionGeneration = INDEX_NONE;
+        int32 OpeningGeneration;
+        uint8 Resolver;
+        bool ApplyDynamicOpenings;
+
+        bool operator==(const FKey& other) const
+        {
+            return Source == other.Source && Listener == other.Listener && PushVector.x == other.PushVector.x &&
+                   PushVector.y == other.PushVector.y && PushVector.z == other.PushVector.z &&
+                   RegionGeneration == other.RegionGeneration && OpeningGeneration == other.OpeningGeneration &&
+                   Resolver == other.Resolver && ApplyDynamicOpenings == other.ApplyDynamicOpenings;
+        }
+
+        friend uint32 GetTypeHash(const FKey& key)
+        {
+            uint32 hash = HashCombine(GetTypeHash(key.Source), GetTypeHash(key.Listener));
+            hash = HashCombine(hash, GetTypeHash(key.RegionGeneration ^ (key.OpeningGeneration << 16)));
+            return HashCombine(hash, GetTypeHash(key.Resolver | (key.ApplyDynamicOpenings ? 0x100 : 0)));
+        }
+    };
+
+    // Look up the results of a previous query from the same grid cells. Returns false on a miss. Either way outKey
+    // is the key to store the query's results under, if it goes on to be run
+    bool Find(
+        const FVector& sourceLocation, const FVector& listenerLocation,
+        const TritonRuntime::InterpolationConfig& interpConfig, const bool applyDynamicOpenings,
+        TritonAcousticParameters& outParams, TritonDynamicOpeningInfo& outOpeningInfo, FKey& outKey);
+
+    // Store the results of a successful query, under the key Find gave out before it was run. If the region or
+    // openings changed while it ran, the key's generations are already stale and the entry is never hit
+    void Add(const FKey& key, const TritonAcousticParameters& params, const TritonDynamicOpeningInfo& openingInfo);
+
+    // Loaded probes have changed. Every entry is now stale
+    void InvalidateRegion()
+    {
+        FPlatformAtomics::InterlockedIncrement(&m_RegionGeneration);
+    }
+
+    // A dynamic opening was added, removed or changed. Entries for sources that apply openings are now stale
+    void InvalidateOpenings()
+    {
+        FPlatformAtomics::InterlockedIncrement(&m_OpeningGeneration);
+    }
+
+    void Reset();
+
+    // Publishes entry count stats. Call once per frame
+    void UpdateStats();
+
+private:
+    // Entries form an intrusive doubly-linked list in most-recently-used order, by index into m_Entries
+    struct FEntry
+    {
+        FKey Key;
+        TritonAcousticParameters Params;
+        TritonDynamicOpeningInfo OpeningInfo;
+        int32 Prev;
+        int32 Next;
+    };
+
+    FKey MakeKey(
+        const FVector& sourceLocation, const FVector& listenerLocation,
+        const TritonRuntime::InterpolationConfig& interpConfig, const bool applyDynamicOpenings) const;
+    void Unlink(const int32 index);
+    void LinkAtHead(const int32 index);
+
+    FCriticalSection m_Lock;
+    // Allocated up front to the budget, so steady-state caching doesn't allocate
+    TArray<FEntry> m_Entries;
+    TMap<FKey, int32> m_Index;
+    int32 m_Head;
+    int32 m_Tail;
+    int32 m_Capacity;
+    float m_GridSize;
+    float m_InverseGridSize;
+    // Written under m_Lock, but read without it as a fast early-out, so accessed atomically
+    volatile int32 m_IsEnabled;
+
+    volatile int32 m_RegionGeneration;
+    volatile int32 m_OpeningGeneration;
+};
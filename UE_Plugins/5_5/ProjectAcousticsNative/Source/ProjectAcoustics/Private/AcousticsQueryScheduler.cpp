@@ -0,0 +1,107 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsQueryScheduler.h"
+
+DEFINE_STAT(STAT_Acoustics_QueryQueueDepth);
+DEFINE_STAT(STAT_Acoustics_QueryMaxWorkerQueueDepth);
+DEFINE_STAT(STAT_Acoustics_QueryDeadlineMisses);
+
+FAcousticsQueryScheduler::FAcousticsQueryScheduler() : m_DeadlineSeconds(0.0)
+{
+}
+
+FAcousticsQueryScheduler::~FAcousticsQueryScheduler()
+{
+    Destroy();
+}
+
+void FAcousticsQueryScheduler::Create(int32 numWorkers)
+{
+    Destroy();
+
+    numWorkers = FMath::Max(numWorkers, 1);
+    m_Workers.SetNum(numWorkers);
+    for (auto& worker : m_Workers)
+    {
+        // One thread per pool, so that all queries for a source happen one at a time, from a single thread
+        worker.Pool = FQueuedThreadPool::Allocate();
+        worker.Pool->Create(1, 32 * 1024, TPri_Normal, TEXT("AcousticsQueryWorker"));
+        worker.QueueDepth = 0;
+    }
+}
+
+void FAcousticsQueryScheduler::Destroy()
+{
+    for (auto& worker : m_Workers)
+    {
+        if (worker.Pool != nullptr)
+        {
+            // Any work still in the queue is abandoned here
+            worker.Pool->Destroy();
+            delete worker.Pool;
+            worker.Pool = nullptr;
+        }
+    }
+    m_Workers.Reset();
+}
+
+int32 FAcousticsQueryScheduler::GetWorkerIndex(const uint64_t sourceObjectId) const
+{
+    // Fold the upper bits in so that IDs which are pointers or otherwise strided still spread across workers
+    const uint32 hash = static_cast<uint32>(sourceObjectId ^ (sourceObjectId >> 32));
+    return static_cast<int32>(hash % static_cast<uint32>(m_Workers.Num()));
+}
+
+void FAcousticsQueryScheduler::AddQueuedWork(const uint64_t sourceObjectId, FAcousticsQueuedWork* work)
+{
+    check(m_Workers.Num() > 0);
+
+    auto& worker = m_Workers[GetWorkerIndex(sourceObjectId)];
+    work->m_QueuedTimeSeconds = FPlatformTime::Seconds();
+    work->m_DeadlineSeconds = work->m_UsesDeadline ? m_DeadlineSeconds : 0.0;
+    work->m_QueueDepthCounter = &worker.QueueDepth;
+    FPlatformAtomics::InterlockedIncrement(&worker.QueueDepth);
+
+    worker.Pool->AddQueuedWork(work);
+}
+
+bool FAcousticsQueryScheduler::RetractQueuedWork(const uint64_t sourceObjectId, FAcousticsQueuedWork* work)
+{
+    if (m_Workers.Num() == 0)
+    {
+        return false;
+    }
+
+    return m_Workers[GetWorkerIndex(sourceObjectId)].Pool->RetractQueuedWork(work);
+}
+
+int32 FAcousticsQueryScheduler::GetQueueDepth() const
+{
+    int32 total = 0;
+    for (int32 i = 0; i < m_Workers.Num(); i++)
+    {
+        total += GetQueueDepth(i);
+    }
+    return total;
+}
+
+int32 FAcousticsQueryScheduler::GetQueueDepth(int32 workerIndex) const
+{
+    return FPlatformAtomics::AtomicRead(&m_Workers[workerIndex].QueueDepth);
+}
+
+void FAcousticsQueryScheduler::BeginFrame()
+{
+    int32 total = 0;
+    int32 maxDepth = 0;
+    for (int32 i = 0; i < m_Workers.Num(); i++)
+    {
+        const int32 depth = GetQueueDepth(i);
+        total += depth;
+        maxDepth = FMath::Max(maxDepth, depth);
+    }
+
+    SET_DWORD_STAT(STAT_Acoustics_QueryQueueDepth, total);
+    SET_DWORD_STAT(STAT_Acoustics_QueryMaxWorkerQueueDepth, maxDepth);
+}
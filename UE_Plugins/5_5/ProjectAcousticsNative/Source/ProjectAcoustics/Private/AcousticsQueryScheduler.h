@@ -0,0 +1,160 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Stats/Stats.h"
+#include "IAcoustics.h"
+#include "AcousticsTaskCounter.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Query Queue Depth"), STAT_Acoustics_QueryQueueDepth, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Max Worker Queue Depth"), STAT_Acoustics_QueryMaxWorkerQueueDepth, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Acoustics Query Deadline Misses"), STAT_Acoustics_QueryDeadlineMisses, STATGROUP_Acoustics, );
+
+// A generic class that accepts a function to do work in Unreal's ThreadPool system.
+// Keeps track of when the task has finished its work or been abandoned. Up to the user
+// to signal when the task has been queued with m_IsQueuedOrRunning.
+// Work that is queued over and over can instead derive from this and override Run, so that re-queuing the same
+// item doesn't need to allocate a new closure each time.
+class FAcousticsQueuedWork : public IQueuedWork
+{
+public:
+    FAcousticsQueuedWork(TFunction<void()>&& inFunction, FAcousticsTaskCounter* inDoneCounter)
+        : m_Function(inFunction), m_DoneCounter(inDoneCounter)
+    {
+    }
+
+    explicit FAcousticsQueuedWork(FAcousticsTaskCounter* inDoneCounter) : m_DoneCounter(inDoneCounter)
+    {
+    }
+
+    virtual ~FAcousticsQueuedWork() = default;
+
+    // The work itself. Runs on the worker thread
+    virtual void Run()
+    {
+        m_Function();
+    }
+
+    // Called instead of Run when the work missed its deadline. Runs on the worker thread
+    virtual void OnDeadlineMissed()
+    {
+    }
+
+    virtual void DoThreadedWork() override
+    {
+        // If this work sat in the queue longer than the scheduler's deadline, its inputs are stale. Drop it rather
+        // than fall further behind. The caller will queue a fresh query on its next update.
+        if (m_DeadlineSeconds > 0.0 && (FPlatformTime::Seconds() - m_QueuedTimeSeconds) > m_DeadlineSeconds)
+        {
+            INC_DWORD_STAT(STAT_Acoustics_QueryDeadlineMisses);
+            OnDeadlineMissed();
+        }
+        else
+        {
+            Run();
+        }
+        SignalStop();
+    }
+
+    virtual void Abandon() override
+    {
+        SignalStop();
+    }
+
+    // Signal to the counters that this item has been queued or is running
+    void SignalStart()
+    {
+        FPlatformAtomics::AtomicStore(&m_IsQueuedOrRunning, 1);
+        m_DoneCounter->Increment();
+    }
+
+    // Signal to the counters that this item has finished, retracted, or abandoned
+    void SignalStop()
+    {
+        if (m_QueueDepthCounter != nullptr)
+        {
+            FPlatformAtomics::InterlockedDecrement(m_QueueDepthCounter);
+            m_QueueDepthCounter = nullptr;
+        }
+        FPlatformAtomics::AtomicStore(&m_IsQueuedOrRunning, 0);
+        m_DoneCounter->Decrement();
+    }
+
+    /** The function to execute on the Task Graph. */
+    TFunction<void()> m_Function;
+
+    // Keep track of when this task is running and not. User should set to 1
+    // when they queue this task
+    volatile int32 m_IsQueuedOrRunning = 0;
+
+    // For updating a caller's running task counter
+    FAcousticsTaskCounter* m_DoneCounter;
+
+    // Whether this work may be dropped when it misses the scheduler's deadline. Only work that is cheap to redo and
+    // whose owner copes with it never running should opt in
+    bool m_UsesDeadline = false;
+
+    // Set by the scheduler when queued. Used for per-worker queue depth and deadline tracking
+    volatile int32* m_QueueDepthCounter = nullptr;
+    double m_QueuedTimeSeconds = 0.0;
+    double m_DeadlineSeconds = 0.0;
+};
+
+// Runs background acoustic queries on a configurable number of worker threads.
+// Each worker is a single-threaded pool, and work is sharded across workers by source ID. This keeps all queries
+// for any one source running one at a time and in order, while queries for different sources run in parallel.
+class FAcousticsQueryScheduler
+{
+public:
+    FAcousticsQueryScheduler();
+    ~FAcousticsQueryScheduler();
+
+    // Create the worker threads. Any existing workers are destroyed first, so only call this when no work is queued
+    void Create(int32 numWorkers);
+    void Destroy();
+
+    // Queue up work for the given source on the worker that owns it
+    void AddQueuedWork(const uint64_t sourceObjectId, FAcousticsQueuedWork* work);
+
+    // Attempt to pull work for the given source back out of its worker's queue. Returns false if it's already running
+    bool RetractQueuedWork(const uint64_t sourceObjectId, FAcousticsQueuedWork* work);
+
+    // Marks the start of a new frame. Publishes queue depth stats for the frame that just ended
+    void BeginFrame();
+
+    int32 GetNumWorkers() const
+    {
+        return m_Workers.Num();
+    }
+
+    // Number of work items queued or running across all workers
+    int32 GetQueueDepth() const;
+
+    // Number of work items queued or running on the given worker
+    int32 GetQueueDepth(int32 workerIndex) const;
+
+    // How long queued work that uses the deadline may wait before it is dropped as stale. 0 disables the deadline
+    void SetDeadlineSeconds(double deadlineSeconds)
+    {
+        m_DeadlineSeconds = deadlineSeconds;
+    }
+
+private:
+    struct FWorker
+    {
+        FQueuedThreadPool* Pool = nullptr;
+        volatile int32 QueueDepth = 0;
+    };
+
+    int32 GetWorkerIndex(const uint64_t sourceObjectId) const;
+
+    // Allocated up front and never resized while workers are live, since queued work holds pointers into it
+    TArray<FWorker> m_Workers;
+    double m_DeadlineSeconds;
+};
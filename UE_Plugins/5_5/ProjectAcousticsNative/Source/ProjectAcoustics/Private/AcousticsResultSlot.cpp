@@ -0,0 +1,115 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsResultSlot.h"
+#include "ProjectAcoustics.h"
+
+DEFINE_STAT(STAT_Acoustics_ResultReadRetries);
+DEFINE_STAT(STAT_Acoustics_ResultWriteCollisions);
+DEFINE_STAT(STAT_Acoustics_StaleResultsDropped);
+
+// A reader that keeps losing the race with a writer gives up and tries again on its next update
+constexpr int32 c_MaxResultReadAttempts = 4;
+
+void FAcousticsSourceQueryWork::Run()
+{
+    // If the source re-registers or unregisters while this runs, the slot's generation moves on and the results
+    // are dropped
+    m_Slot->Publish(
+        m_Module->GetAcousticQueryResults(m_SourceObjectId, m_SourceLocation, m_ListenerLocation, m_ObjectParams),
+        m_Generation);
+}
+
+void FAcousticsSourceQueryWork::OnDeadlineMissed()
+{
+    FPlatformAtomics::AtomicStore(&m_Slot->QueryDropped, 1);
+}
+
+bool FAcousticsResultSlot::Publish(const AcousticQueryResults& results, const int32 generation)
+{
+    // Claim the slot by making the sequence odd. Only one writer can win, the loser drops its results
+    const int32 sequence = FPlatformAtomics::AtomicRead(&Sequence);
+    if ((sequence & 1) != 0 ||
+        FPlatformAtomics::InterlockedCompareExchange(&Sequence, sequence + 1, sequence) != sequence)
+    {
+        INC_DWORD_STAT(STAT_Acoustics_ResultWriteCollisions);
+        return false;
+    }
+
+    if (FPlatformAtomics::AtomicRead(&Generation) != generation)
+    {
+        // Slot was re-assigned while this query was running. Nothing was written, so hand back the old sequence
+        FPlatformAtomics::AtomicStore(&Sequence, sequence);
+        INC_DWORD_STAT(STAT_Acoustics_StaleResultsDropped);
+        return false;
+    }
+
+    FPlatformMisc::MemoryBarrier();
+    ResultsGeneration = generation;
+    Results = results;
+    FPlatformMisc::MemoryBarrier();
+
+    FPlatformAtomics::AtomicStore(&Sequence, sequence + 2);
+    return true;
+}
+
+bool FAcousticsResultSlot::Take(AcousticQueryResults& outResults)
+{
+    return Read(outResults, true);
+}
+
+bool FAcousticsResultSlot::TakeLatest(AcousticQueryResults& outResults)
+{
+    return Read(outResults, false);
+}
+
+bool FAcousticsResultSlot::Read(AcousticQueryResults& outResults, const bool onlyNew)
+{
+    for (int32 attempt = 0; attempt < c_MaxResultReadAttempts; attempt++)
+    {
+        const int32 sequence = FPlatformAtomics::AtomicRead(&Sequence);
+        if (onlyNew && sequence == LastTakenSequence)
+        {
+            return false;
+        }
+        if ((sequence & 1) != 0)
+        {
+            INC_DWORD_STAT(STAT_Acoustics_ResultReadRetries);
+            FPlatformProcess::YieldThread();
+            continue;
+        }
+
+        FPlatformMisc::MemoryBarrier();
+        const int32 resultsGeneration = ResultsGeneration;
+        outResults = Results;
+        FPlatformMisc::MemoryBarrier();
+
+        if (FPlatformAtomics::AtomicRead(&Sequence) != sequence)
+        {
+            // A writer got in while we were copying. What we have may be torn
+            INC_DWORD_STAT(STAT_Acoustics_ResultReadRetries);
+            continue;
+        }
+
+        LastTakenSequence = sequence;
+        if (resultsGeneration != FPlatformAtomics::AtomicRead(&Generation))
+        {
+            // Results belong to the slot's previous source
+            INC_DWORD_STAT(STAT_Acoustics_StaleResultsDropped);
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void FAcousticsResultSlot::Reset()
+{
+    FPlatformAtomics::InterlockedIncrement(&Generation);
+    // Whatever is published right now belongs to the old generation. Anything published after this is newer,
+    // and gets checked against the generation when taken
+    LastTakenSequence = FPlatformAtomics::AtomicRead(&Sequence) & ~1;
+    HasProcessed = false;
+    HasLastResults = false;
+    FPlatformAtomics::AtomicStore(&QueryDropped, 0);
+}
@@ -0,0 +1,145 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "IAcoustics.h"
+#include "TritonDebugInterface.h"
+#include "AcousticsQueryScheduler.h"
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Acoustics Result Read Retries"), STAT_Acoustics_ResultReadRetries, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Acoustics Result Write Collisions"), STAT_Acoustics_ResultWriteCollisions, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Acoustics Stale Results Dropped"), STAT_Acoustics_StaleResultsDropped, STATGROUP_Acoustics, );
+
+class FProjectAcousticsModule;
+struct FAcousticsResultSlot;
+
+// All the results from a Triton acoustics query
+struct AcousticQueryResults
+{
+    TritonAcousticParameters AcousticParams;
+    TritonDynamicOpeningInfo OpeningInfo;
+    TritonRuntime::QueryDebugInfo QueryDebugInfo;
+    // Whether the acoustic query was successful or not
+    bool QueryResult;
+};
+
+// Background query for one source. Each result slot owns exactly one of these and re-queues it for every query,
+// copying the request in beforehand. A source never has more than one query in flight, so steady-state queuing
+// doesn't touch the heap.
+class FAcousticsSourceQueryWork : public FAcousticsQueuedWork
+{
+public:
+    FAcousticsSourceQueryWork(
+        FProjectAcousticsModule* module, FAcousticsResultSlot* slot, FAcousticsTaskCounter* doneCounter)
+        : FAcousticsQueuedWork(doneCounter), m_Module(module), m_Slot(slot)
+    {
+        // A source whose query is dropped just keeps its last results until the next one
+        m_UsesDeadline = true;
+    }
+
+    // Runs the query and publishes its results into the owning slot
+    virtual void Run() override;
+    virtual void OnDeadlineMissed() override;
+
+    // Copy in the inputs for the next query. Only call while the work isn't queued or running
+    void SetRequest(
+        const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticsObjectParams& objectParams, const int32 generation)
+    {
+        m_SourceObjectId = sourceObjectId;
+        m_SourceLocation = sourceLocation;
+        m_ListenerLocation = listenerLocation;
+        m_ObjectParams = objectParams;
+        m_Generation = generation;
+    }
+
+    // Request inputs. Only written while the work isn't queued or running
+    uint64_t m_SourceObjectId = 0;
+    FVector m_SourceLocation = FVector::ZeroVector;
+    FVector m_ListenerLocation = FVector::ZeroVector;
+    AcousticsObjectParams m_ObjectParams;
+    // Slot generation when this query was queued
+    int32 m_Generation = 0;
+
+private:
+    FProjectAcousticsModule* m_Module;
+    FAcousticsResultSlot* m_Slot;
+};
+
+// Holds the latest query results for one registered source.
+// Results are published with a seqlock: the writer makes Sequence odd, copies the results in, then makes it even
+// again. Readers copy the results out and retry if Sequence was odd or changed underneath them, so neither side
+// ever blocks on the other. Slots are heap allocated once and never move, so background queries can hold on to
+// them without taking any lock.
+struct FAcousticsResultSlot
+{
+    FAcousticsResultSlot(FProjectAcousticsModule* module, FAcousticsTaskCounter* doneCounter)
+        : QueuedWork(module, this, doneCounter)
+    {
+    }
+
+    // Copy new results in. Returns false if they were dropped, either because another writer is mid-publish or
+    // because the slot has been re-assigned since the query for this generation was started
+    bool Publish(const AcousticQueryResults& results, const int32 generation);
+
+    // Copy out results that haven't been taken yet. Returns false if there's nothing new, or if a writer kept the
+    // slot busy for every attempt. Only the thread that updates this slot's source may call this
+    bool Take(AcousticQueryResults& outResults);
+
+    // Copy out the latest results for the slot's current generation, even if they have been taken before
+    bool TakeLatest(AcousticQueryResults& outResults);
+    bool Read(AcousticQueryResults& outResults, const bool onlyNew);
+
+    // Start a new generation, on (re-)registration or unregistration. Results still in flight for the previous
+    // generation will be dropped
+    void Reset();
+
+    // Odd while a writer is publishing
+    volatile int32 Sequence = 0;
+    // Generation the published results were queried for. Written inside the seqlock alongside Results
+    int32 ResultsGeneration = 0;
+    AcousticQueryResults Results;
+
+    // Bumped every time the slot is reset. Background queries capture it when queued and compare on publish
+    volatile int32 Generation = 0;
+
+    // Set when the slot's last background query was dropped for missing the scheduler's deadline
+    volatile int32 QueryDropped = 0;
+
+    // Reader-side state. Only touched by the thread updating this slot's source, or under the slot table's
+    // write lock. The ID is kept after unregistering, because it picks the worker any in-flight query was queued on
+    uint64_t SourceObjectId = 0;
+    int32 LastTakenSequence = 0;
+    // Whether or not this source has processed any frames so far
+    bool HasProcessed = false;
+
+    // Adaptive query rate state. Also reader-side.
+    // Where and when the last query was queued, and how many frames it came after the one before
+    FVector LastQuerySourceLocation = FVector::ZeroVector;
+    FVector LastQueryListenerLocation = FVector::ZeroVector;
+    int32 LastQueryFrame = 0;
+    int32 LastQueryInterval = 1;
+    // Latest results taken from the slot. Returned again on frames where the source isn't queried
+    AcousticQueryResults LastResults;
+    bool HasLastResults = false;
+    // New results are blended in from the last returned parameters over InterpFrames frames
+    TritonAcousticParameters InterpFrom;
+    TritonAcousticParameters LastReturnedParams;
+    int32 InterpStartFrame = 0;
+    int32 InterpFrames = 1;
+
+    // Query budget state. Guarded by the module's pending query lock.
+    // Set while the slot's work holds a request that is waiting for a frame with budget left to run it
+    bool IsQueryPending = false;
+    int32 PendingSinceFrame = 0;
+    // How loud the source was at its last query, after distance attenuation. Higher goes first
+    float QueryAudibilityDb = 0.0f;
+    // This source's background query. Re-used for every query, and kept so we can retract it from the pool if needed
+    FAcousticsSourceQueryWork QueuedWork;
+};
@@ -4,6 +4,7 @@
 #include "AcousticsRuntimeVolume.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Components/BrushComponent.h"
+#include "AcousticsRuntimeVolumeIndex.h"
 
 AAcousticsRuntimeVolume::AAcousticsRuntimeVolume(const class FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -18,4 +19,46 @@ AAcousticsRuntimeVolume::AAcousticsRuntimeVolume(const class FObjectInitializer&
     {
         PrimitiveComponent->SetCollisionResponseToAllChannels(ECR_Overlap);
     }
-}
\ No newline at end of file
+}
+
+void AAcousticsRuntimeVolume::PostRegisterAllComponents()
+{
+    Super::PostRegisterAllComponents();
+
+    if (USceneComponent* root = GetRootComponent())
+    {
+        root->TransformUpdated.RemoveAll(this);
+        root->TransformUpdated.AddUObject(this, &AAcousticsRuntimeVolume::OnTransformUpdated);
+    }
+    FAcousticsRuntimeVolumeIndex::Get().AddOrUpdate(this);
+}
+
+void AAcousticsRuntimeVolume::PostUnregisterAllComponents()
+{
+    if (USceneComponent* root = GetRootComponent())
+    {
+        root->TransformUpdated.RemoveAll(this);
+    }
+    FAcousticsRuntimeVolumeIndex::Get().Remove(this);
+
+    Super::PostUnregisterAllComponents();
+}
+
+#if WITH_EDITOR
+// The brush may have been reshaped
+void AAcousticsRuntimeVolume::PostEditChangeProperty(FPropertyChangedEvent& e)
+{
+    Super::PostEditChangeProperty(e);
+
+    if (GetRootComponent() && GetRootComponent()->IsRegistered())
+    {
+        FAcousticsRuntimeVolumeIndex::Get().AddOrUpdate(this);
+    }
+}
+#endif
+
+void AAcousticsRuntimeVolume::OnTransformUpdated(
+    USceneComponent* component, EUpdateTransformFlags updateTransformFlags, ETeleportType teleport)
+{
+    FAcousticsRuntimeVolumeIndex::Get().AddOrUpdate(this);
+}
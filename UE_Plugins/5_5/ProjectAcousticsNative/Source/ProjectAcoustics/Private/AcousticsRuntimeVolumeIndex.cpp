@@ -0,0 +1,210 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsRuntimeVolumeIndex.h"
+#include "AcousticsRuntimeVolume.h"
+#include "IAcoustics.h"
+#include "Components/BrushComponent.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Acoustics Volume Lookups"), STAT_Acoustics_VolumeLookups, STATGROUP_Acoustics);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Acoustics Runtime Volumes"), STAT_Acoustics_RuntimeVolumes, STATGROUP_Acoustics);
+
+// Edge length of a grid cell, in cm. Runtime volumes are usually room-sized, so most cover only a few cells
+constexpr float c_VolumeGridCellSize = 2000.0f;
+// Volumes overlapping more cells than this are checked on every lookup instead of being added to the grid
+constexpr int64 c_MaxCellsPerVolume = 512;
+
+// Volumes were once found with a physics overlap on the WorldStatic channel, which skipped volumes whose collision is
+// turned off. Keep honouring that, so turning off collision still turns off a volume
+static bool IsCollisionEnabled(const AAcousticsRuntimeVolume* volume)
+{
+    const UBrushComponent* brush = volume->GetBrushComponent();
+    return volume->GetActorEnableCollision() && brush != nullptr && brush->IsQueryCollisionEnabled() &&
+           brush->GetCollisionObjectType() == ECC_WorldStatic;
+}
+
+FAcousticsRuntimeVolumeIndex& FAcousticsRuntimeVolumeIndex::Get()
+{
+    static FAcousticsRuntimeVolumeIndex s_Index;
+    return s_Index;
+}
+
+FAcousticsRuntimeVolumeIndex::FAcousticsRuntimeVolumeIndex() : m_Generation(1)
+{
+}
+
+void FAcousticsRuntimeVolumeIndex::AddOrUpdate(const AAcousticsRuntimeVolume* volume)
+{
+    const UBrushComponent* brush = volume ? volume->GetBrushComponent() : nullptr;
+    if (brush == nullptr)
+    {
+        return;
+    }
+
+    FEntry entry;
+    entry.Volume = volume;
+    entry.World = volume->GetWorld();
+    entry.Transform = brush->GetComponentTransform();
+    entry.LocalBounds = brush->CalcBounds(FTransform::Identity).GetBox();
+    entry.WorldBounds = entry.LocalBounds.TransformBy(entry.Transform);
+    entry.IsLarge = false;
+
+    FWriteScopeLock lock(m_Lock);
+    const int32* existingId = m_EntryIds.Find(volume);
+    if (existingId != nullptr)
+    {
+        const FEntry& existing = m_Entries[*existingId];
+        if (existing.World == entry.World && existing.WorldBounds == entry.WorldBounds &&
+            existing.LocalBounds == entry.LocalBounds && existing.Transform.Equals(entry.Transform, 0.0f))
+        {
+            return;
+        }
+        RemoveFromGrid(*existingId);
+        m_Entries[*existingId] = entry;
+        AddToGrid(*existingId);
+    }
+    else
+    {
+        const int32 entryId = m_Entries.Add(entry);
+        m_EntryIds.Add(volume, entryId);
+        AddToGrid(entryId);
+    }
+
+    m_Generation++;
+    SET_DWORD_STAT(STAT_Acoustics_RuntimeVolumes, m_Entries.Num());
+}
+
+void FAcousticsRuntimeVolumeIndex::Remove(const AAcousticsRuntimeVolume* volume)
+{
+    FWriteScopeLock lock(m_Lock);
+    int32 entryId;
+    if (!m_EntryIds.RemoveAndCopyValue(volume, entryId))
+    {
+        return;
+    }
+
+    RemoveFromGrid(entryId);
+    m_Entries.RemoveAt(entryId);
+    m_Generation++;
+    SET_DWORD_STAT(STAT_Acoustics_RuntimeVolumes, m_Entries.Num());
+}
+
+void FAcousticsRuntimeVolumeIndex::ApplyOverrides(
+    const UWorld* world, const FVector& location, FAcousticsVolumeLookupCache& cache,
+    FAcousticsDesignParams& designParams)
+{
+    // Volumes only leave the index on the game thread, under the write lock, and are never destroyed before they
+    // leave. So every volume reached from here is still alive until the lock is released
+    FReadScopeLock lock(m_Lock);
+    if (cache.Generation != m_Generation || cache.World != world || cache.Location != location)
+    {
+        INC_DWORD_STAT(STAT_Acoustics_VolumeLookups);
+        cache.Entries.Reset();
+        cache.World = world;
+        cache.Location = location;
+        cache.Generation = m_Generation;
+
+        if (const TArray<int32>* cell = m_Cells.Find(GetCell(location)))
+        {
+            for (const int32 entryId : *cell)
+            {
+                if (Contains(m_Entries[entryId], world, location))
+                {
+                    cache.Entries.Add(entryId);
+                }
+            }
+        }
+        for (const int32 entryId : m_LargeEntries)
+        {
+            if (Contains(m_Entries[entryId], world, location))
+            {
+                cache.Entries.Add(entryId);
+            }
+        }
+    }
+
+    // Combined on every call rather than cached, since the params and collision can be changed at any time from
+    // Blueprint
+    for (const int32 entryId : cache.Entries)
+    {
+        const AAcousticsRuntimeVolume* volume = m_Entries[entryId].Volume;
+        if (IsCollisionEnabled(volume))
+        {
+            FAcousticsDesignParams::Combine(designParams, volume->OverrideDesignParams);
+        }
+    }
+}
+
+bool FAcousticsRuntimeVolumeIndex::Contains(const FEntry& entry, const UWorld* world, const FVector& location) const
+{
+    return entry.World == world && entry.WorldBounds.IsInsideOrOn(location) &&
+           entry.LocalBounds.IsInsideOrOn(entry.Transform.InverseTransformPosition(location));
+}
+
+void FAcousticsRuntimeVolumeIndex::AddToGrid(const int32 entryId)
+{
+    FEntry& entry = m_Entries[entryId];
+    const FIntVector minCell = GetCell(entry.WorldBounds.Min);
+    const FIntVector maxCell = GetCell(entry.WorldBounds.Max);
+    const int64 numCells = static_cast<int64>(maxCell.X - minCell.X + 1) * (maxCell.Y - minCell.Y + 1) *
+                           (maxCell.Z - minCell.Z + 1);
+
+    entry.IsLarge = numCells > c_MaxCellsPerVolume;
+    if (entry.IsLarge)
+    {
+        m_LargeEntries.Add(entryId);
+        return;
+    }
+
+    for (int32 x = minCell.X; x <= maxCell.X; x++)
+    {
+        for (int32 y = minCell.Y; y <= maxCell.Y; y++)
+        {
+            for (int32 z = minCell.Z; z <= maxCell.Z; z++)
+            {
+                m_Cells.FindOrAdd(FIntVector(x, y, z)).Add(entryId);
+            }
+        }
+    }
+}
+
+void FAcousticsRuntimeVolumeIndex::RemoveFromGrid(const int32 entryId)
+{
+    const FEntry& entry = m_Entries[entryId];
+    if (entry.IsLarge)
+    {
+        m_LargeEntries.RemoveSwap(entryId);
+        return;
+    }
+
+    const FIntVector minCell = GetCell(entry.WorldBounds.Min);
+    const FIntVector maxCell = GetCell(entry.WorldBounds.Max);
+    for (int32 x = minCell.X; x <= maxCell.X; x++)
+    {
+        for (int32 y = minCell.Y; y <= maxCell.Y; y++)
+        {
+            for (int32 z = minCell.Z; z <= maxCell.Z; z++)
+            {
+                const FIntVector cellKey(x, y, z);
+                TArray<int32>* cell = m_Cells.Find(cellKey);
+                if (cell != nullptr)
+                {
+                    cell->RemoveSwap(entryId);
+                    if (cell->Num() == 0)
+                    {
+                        m_Cells.Remove(cellKey);
+                    }
+                }
+            }
+        }
+    }
+}
+
+FIntVector FAcousticsRuntimeVolumeIndex::GetCell(const FVector& location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(location.X / c_VolumeGridCellSize),
+        FMath::FloorToInt32(location.Y / c_VolumeGridCellSize),
+        FMath::FloorToInt32(location.Z / c_VolumeGridCellSize));
+}
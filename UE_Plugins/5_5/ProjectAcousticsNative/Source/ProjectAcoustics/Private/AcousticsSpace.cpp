@@ -5,6 +5,7 @@
 #include "IAcoustics.h"
 #include <Classes/GameFramework/HUD.h>
 #include <Classes/GameFramework/PlayerController.h>
+#include "HAL/IConsoleManager.h"
 
 // Console commands for toggling debug info
 static TAutoConsoleVariable<int32>
@@ -21,6 +22,11 @@ static TAutoConsoleVariable<int32> CVarAcousticsShowAllSourceParameters(
          "debug display for all sources, 3: Let the individual source decide whether to show acoustic "
          "parameters debug display\n"));
 
+// Time constant (seconds) for smoothing listener velocity and acceleration in predictive streaming
+constexpr float c_ListenerMotionSmoothingSeconds = 0.25f;
+// Listener speeds above this (cm/s) are treated as teleports, which reset prediction instead of extrapolating
+constexpr float c_ListenerTeleportSpeed = 10000.0f;
+
 AAcousticsSpace::AAcousticsSpace(const class FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
     PrimaryActorTick.bCanEverTick = true;
@@ -37,10 +43,18 @@ AAcousticsSpace::AAcousticsSpace(const class FObjectInitializer& ObjectInitializ
     // Main parameters
     TileSize = FVector(5000, 5000, 5000);
     AutoStream = true;
+    PredictiveStreaming = false;
+    PredictionLookaheadSeconds = 1.0f;
+    PredictionHysteresis = 0.25f;
     UpdateDistances = false;
     CacheScale = 1.0f;
 
     m_Acoustics = nullptr;
+    m_LastListenerPosition = FVector::ZeroVector;
+    m_ListenerVelocity = FVector::ZeroVector;
+    m_ListenerAcceleration = FVector::ZeroVector;
+    m_HasListenerHistory = false;
+    m_PredictedLoadCenter = FVector::ZeroVector;
 
     // Debug controls
     AcousticsEnabled = true;
@@ -78,7 +92,9 @@ void AAcousticsSpace::BeginPlay()
         {
             // Stream in the first tile if AutoLoad is enabled
             auto listenerPosition = GetListenerPosition();
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, true, true, false);
+            m_Acoustics->UpdateLoadedRegion(
+                listenerPosition, TileSize, true, !m_Acoustics->IsProbeBudgetEnabled(), false);
+            ResetPredictiveStreaming(listenerPosition);
         }
     }
 
@@ -150,14 +166,22 @@ void AAcousticsSpace::Tick(float deltaSeconds)
         auto listenerPosition = GetListenerPosition();
 
         // Update streaming
-        if (AutoStream)
+        if (AutoStream && PredictiveStreaming)
+        {
+            UpdatePredictiveStreaming(listenerPosition, deltaSeconds);
+        }
+        else if (AutoStream)
         {
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, false, true, false);
+            // With a probe memory budget, earlier tiles stay loaded until the budget needs their memory back
+            m_Acoustics->UpdateLoadedRegion(
+                listenerPosition, TileSize, false, !m_Acoustics->IsProbeBudgetEnabled(), false);
         }
 
-        // If there are active emitters in the scene, they will
-        // update outdoorness each frame automatically. But if there are
-        // no active emitters this frame, we hand-crank outdoorness.
+        // Keeps the regions around the listener from being unloaded to stay within PA.ProbeBudgetMB
+        m_Acoustics->TouchLoadedRegions(listenerPosition);
+
+        // Outdoorness is computed in the background, and only once the listener
+        // has moved far enough or the loaded probes have changed.
         m_Acoustics->UpdateOutdoorness(listenerPosition);
 
         // Update distances
@@ -171,6 +195,74 @@ void AAcousticsSpace::Tick(float deltaSeconds)
     m_Acoustics->PostTick();
 }
 
+void AAcousticsSpace::ResetPredictiveStreaming(const FVector& loadCenter)
+{
+    m_PredictedLoadCenter = loadCenter;
+    m_ListenerVelocity = FVector::ZeroVector;
+    m_ListenerAcceleration = FVector::ZeroVector;
+    m_HasListenerHistory = false;
+}
+
+void AAcousticsSpace::UpdatePredictiveStreaming(const FVector& listenerPosition, float deltaSeconds)
+{
+    if (deltaSeconds <= 0.0f)
+    {
+        return;
+    }
+
+    // Track smoothed velocity and acceleration of the listener
+    if (m_HasListenerHistory)
+    {
+        const FVector velocitySample = (listenerPosition - m_LastListenerPosition) / deltaSeconds;
+        if (velocitySample.SizeSquared() > FMath::Square(c_ListenerTeleportSpeed))
+        {
+            // Teleported. Nothing to extrapolate from, just load around the new position
+            m_Acoustics->UpdateLoadedRegion(
+                listenerPosition, TileSize, true, !m_Acoustics->IsProbeBudgetEnabled(), false);
+            ResetPredictiveStreaming(listenerPosition);
+            m_LastListenerPosition = listenerPosition;
+            m_HasListenerHistory = true;
+            return;
+        }
+
+        const float alpha = 1.0f - FMath::Exp(-deltaSeconds / c_ListenerMotionSmoothingSeconds);
+        const FVector lastVelocity = m_ListenerVelocity;
+        m_ListenerVelocity = FMath::Lerp(m_ListenerVelocity, velocitySample, alpha);
+        m_ListenerAcceleration =
+            FMath::Lerp(m_ListenerAcceleration, (m_ListenerVelocity - lastVelocity) / deltaSeconds, alpha);
+    }
+    m_LastListenerPosition = listenerPosition;
+    m_HasListenerHistory = true;
+
+    // The module reloads once the listener gets within the load margin of the tile's border. Split that safe region
+    // into a hysteresis band, and the room left over for leading the listener. Keeping the predicted offset within
+    // (safe region - band) means the listener can never drift out of the safe region of the last requested tile
+    // before the next request goes out.
+    static IConsoleVariable* loadMarginCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("PA.AceTileLoadMargin"));
+    const float loadMargin = loadMarginCVar != nullptr ? loadMarginCVar->GetFloat() : 0.8f;
+    const FVector safeExtent = TileSize.GetAbs() * 0.5f * loadMargin;
+    const FVector hysteresisBand = safeExtent * FMath::Clamp(PredictionHysteresis, 0.05f, 1.0f);
+    const FVector maxLead = safeExtent - hysteresisBand;
+
+    const float lookahead = FMath::Max(PredictionLookaheadSeconds, 0.0f);
+    const FVector predictedOffset =
+        m_ListenerVelocity * lookahead + 0.5f * m_ListenerAcceleration * lookahead * lookahead;
+    const FVector loadCenter =
+        listenerPosition + FVector(
+                               FMath::Clamp(predictedOffset.X, -maxLead.X, maxLead.X),
+                               FMath::Clamp(predictedOffset.Y, -maxLead.Y, maxLead.Y),
+                               FMath::Clamp(predictedOffset.Z, -maxLead.Z, maxLead.Z));
+
+    const FVector drift = (loadCenter - m_PredictedLoadCenter).GetAbs();
+    if (drift.X > hysteresisBand.X || drift.Y > hysteresisBand.Y || drift.Z > hysteresisBand.Z)
+    {
+        // Non-blocking, so probes ahead of the listener stream in while it's still inside the current tile
+        m_Acoustics->UpdateLoadedRegion(
+            loadCenter, TileSize, true, !m_Acoustics->IsProbeBudgetEnabled(), false);
+        m_PredictedLoadCenter = loadCenter;
+    }
+}
+
 void AAcousticsSpace::BeginDestroy()
 {
     Super::BeginDestroy();
@@ -236,7 +328,9 @@ bool AAcousticsSpace::LoadAceFile(FString filePath)
         if (AutoStream)
         {
             auto listenerPosition = GetListenerPosition();
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, true, true, false);
+            m_Acoustics->UpdateLoadedRegion(
+                listenerPosition, TileSize, true, !m_Acoustics->IsProbeBudgetEnabled(), false);
+            ResetPredictiveStreaming(listenerPosition);
         }
     }
     else
@@ -0,0 +1,94 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "IAcoustics.h"
+
+// Counts outstanding background tasks and lets a thread sleep until they have all finished.
+// The waiting thread blocks on an FEvent that is triggered when the count drops to zero, rather than spinning.
+// The counter's owner may be destroyed as soon as a drain sees zero, so the event is shared with every decrement in
+// flight, and only goes back to the pool once the last of them has triggered it.
+class FAcousticsTaskCounter
+{
+public:
+    FAcousticsTaskCounter()
+        : m_Count(0)
+        , m_DrainedEvent(
+              FPlatformProcess::GetSynchEventFromPool(true),
+              [](FEvent* event) { FPlatformProcess::ReturnSynchEventToPool(event); })
+    {
+    }
+
+    FAcousticsTaskCounter(const FAcousticsTaskCounter&) = delete;
+    FAcousticsTaskCounter& operator=(const FAcousticsTaskCounter&) = delete;
+
+    void Increment()
+    {
+        FPlatformAtomics::InterlockedIncrement(&m_Count);
+    }
+
+    void Decrement()
+    {
+        // Once the count reaches zero, this counter may be destroyed before the next line runs. Only touch the
+        // event through our own reference after that
+        const TSharedRef<FEvent, ESPMode::ThreadSafe> drainedEvent = m_DrainedEvent;
+        if (FPlatformAtomics::InterlockedDecrement(&m_Count) == 0)
+        {
+            drainedEvent->Trigger();
+        }
+    }
+
+    int32 GetCount() const
+    {
+        return FPlatformAtomics::AtomicRead(&m_Count);
+    }
+
+    // Block until the count reaches zero. Each wait is bounded by warnAfterMs, after which a warning naming the
+    // caller is logged and the wait continues, so a stuck task shows up in the log instead of as a silent hang.
+    // Returns how long the drain took, in seconds.
+    double Drain(const TCHAR* name, const uint32 warnAfterMs = 1000)
+    {
+        const double startSeconds = FPlatformTime::Seconds();
+        const int32 startCount = GetCount();
+        while (GetCount() > 0)
+        {
+            // Reset before re-checking, so a trigger that lands in between isn't lost
+            m_DrainedEvent->Reset();
+            if (GetCount() == 0)
+            {
+                break;
+            }
+            if (!m_DrainedEvent->Wait(warnAfterMs))
+            {
+                UE_LOG(
+                    LogAcousticsRuntime,
+                    Warning,
+                    TEXT("%s: still waiting on %d background tasks after %.1f ms"),
+                    name,
+                    GetCount(),
+                    (FPlatformTime::Seconds() - startSeconds) * 1000.0);
+            }
+        }
+
+        const double elapsedSeconds = FPlatformTime::Seconds() - startSeconds;
+        if (startCount > 0)
+        {
+            UE_LOG(
+                LogAcousticsRuntime,
+                Verbose,
+                TEXT("%s: drained %d background tasks in %.2f ms"),
+                name,
+                startCount,
+                elapsedSeconds * 1000.0);
+        }
+        return elapsedSeconds;
+    }
+
+private:
+    volatile int32 m_Count;
+    TSharedRef<FEvent, ESPMode::ThreadSafe> m_DrainedEvent;
+};
@@ -5,6 +5,7 @@
 #include "ProjectAcoustics.h"
 #include "IAcoustics.h"
 #include "AcousticsDebugRender.h"
+#include "AcousticsDynamicOpening.h"
 
 using namespace TritonRuntime;
 
@@ -17,6 +18,10 @@ DEFINE_STAT(STAT_Acoustics_QueryOutdoorness);
 DEFINE_STAT(STAT_Acoustics_LoadRegion);
 DEFINE_STAT(STAT_Acoustics_LoadAce);
 DEFINE_STAT(STAT_Acoustics_ClearAce);
+DEFINE_STAT(STAT_Acoustics_QueriesSkipped);
+DEFINE_STAT(STAT_Acoustics_OpeningUpdates);
+DEFINE_STAT(STAT_Acoustics_PendingQueries);
+DEFINE_STAT(STAT_Acoustics_AverageQueryCost);
 
 // Safety margin for ACE streaming loads.
 // When player gets to within this fraction of the loaded region's border,
@@ -32,6 +37,177 @@ static FAutoConsoleVariableRef CVarAcousticsAceTileLoadMargin(
                 TEXT("0 is extremely safe but lots of I/O, 1 is no safety.\n"),
     ECVF_Default);
 
+// How ACE files are read. 0 goes through a cache that supports PAK files, 1 memory-maps the file
+int32 c_AceIOMode = 0;
+static FAutoConsoleVariableRef CVarAcousticsAceIOMode(
+    TEXT("PA.AceIOMode"), c_AceIOMode,
+    TEXT("How ACE files are read. 0: through a read-ahead cache. 1: memory-mapped, falling back to the\n")
+        TEXT("cache for files that can't be mapped, such as those inside PAK files.\n")
+            TEXT("Takes effect the next time an ACE file is loaded. Compare modes by replaying a trace with\n")
+                TEXT("the AceIOTraceReplay tool.\n"),
+    ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+// Record every ACE file read and seek to a trace file under Saved/Acoustics, for offline analysis of streaming I/O
+int32 c_AceIOTrace = 0;
+static FAutoConsoleVariableRef CVarAcousticsAceIOTrace(
+    TEXT("PA.AceIOTrace"), c_AceIOTrace,
+    TEXT("When non-zero, all ACE file I/O is recorded to a binary trace in Saved/Acoustics.\n")
+        TEXT("Takes effect the next time an ACE file is loaded.\n"),
+    ECVF_Default);
+#endif
+
+// Ceiling on the memory Triton may use for loaded probes, in megabytes. 0 disables the budget.
+// Needs Triton memory to be tracked, which it is outside shipping builds, or with ACOUSTICS_TRACK_MEMORY=1
+float c_ProbeBudgetMB = 0.0f;
+static FAutoConsoleVariableRef CVarAcousticsProbeBudgetMB(
+    TEXT("PA.ProbeBudgetMB"), c_ProbeBudgetMB,
+    TEXT("When Triton uses more than this many megabytes, the loaded region the listener visited least\n")
+        TEXT("recently is unloaded. While set, Acoustics Space streaming keeps earlier tiles loaded, and regions are\n")
+            TEXT("evicted before a new tile is loaded so it fits. 0 disables the budget.\n"),
+    ECVF_Default);
+
+// Frames to wait for an evicted region's unload to show up in Triton's memory use before evicting another
+constexpr int32 c_ProbeEvictionTimeoutFrames = 30;
+
+// Serve Triton's small allocations from size-class pools rather than straight from FMemory
+int32 c_PooledMemory = 0;
+static FAutoConsoleVariableRef CVarAcousticsPooledMemory(
+    TEXT("PA.PooledMemory"), c_PooledMemory,
+    TEXT("When non-zero, Triton's small allocations are served from size-class pools.\n")
+        TEXT("Read once at startup, so set it in an ini file. PA.MemPoolReport shows pool usage.\n"),
+    ECVF_Default);
+
+// Number of worker threads running background acoustic queries.
+// Sources are sharded across workers by source ID, so queries for any one source still run in order.
+// With more than one worker, QueryAcoustics and GetOutdoornessAtListener run concurrently on the same Triton
+// instance. Triton's API doesn't document whether that is safe, so the default stays at one worker, which calls
+// Triton from a single thread just as before. At that default, queries don't run in parallel at all: the worker
+// pool and batch chunking are in place for when concurrent queries are known to be safe. Only raise it after
+// checking it against the Triton version in use, and measuring that it helps.
+int32 c_NumQueryWorkers = 1;
+static FAutoConsoleVariableRef CVarAcousticsNumQueryWorkers(
+    TEXT("PA.NumQueryWorkers"), c_NumQueryWorkers,
+    TEXT("Number of worker threads used for background acoustic queries.\n")
+        TEXT("Takes effect the next time an ACE file is loaded. At the default of 1, queries are not run in\n")
+        TEXT("parallel. Values above 1 are experimental: they run Triton queries concurrently, which Triton\n")
+        TEXT("does not document as thread-safe.\n"),
+    ECVF_Default);
+
+// How long (in milliseconds) a background source query may sit in a worker's queue before it is dropped as stale.
+// Other background work, like batches, outdoorness and opening updates, always runs. 0 disables the deadline.
+float c_QueryDeadlineMs = 0.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryDeadlineMs(
+    TEXT("PA.QueryDeadlineMs"), c_QueryDeadlineMs,
+    TEXT("Background source queries that wait longer than this many milliseconds are dropped, and the source\n")
+        TEXT("keeps its last results until its next query. 0 disables the deadline.\n"),
+    ECVF_Default);
+
+// Optional cache of query results, keyed on quantized source and listener positions
+int32 c_QueryCacheEnabled = 0;
+static FAutoConsoleVariableRef CVarAcousticsQueryCacheEnabled(
+    TEXT("PA.QueryCacheEnabled"), c_QueryCacheEnabled,
+    TEXT("When non-zero, acoustic query results are cached and re-used for sources and listeners\n")
+        TEXT("that stay within the same grid cells.\n"),
+    ECVF_Default);
+
+float c_QueryCacheGridSize = 25.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryCacheGridSize(
+    TEXT("PA.QueryCacheGridSize"), c_QueryCacheGridSize,
+    TEXT("Size of the query cache grid cells, in Unreal units. Positions within the same cell share results,\n")
+        TEXT("so this bounds the positional error of a cached result.\n"),
+    ECVF_Default);
+
+int32 c_QueryCacheBudgetKB = 256;
+static FAutoConsoleVariableRef CVarAcousticsQueryCacheBudgetKB(
+    TEXT("PA.QueryCacheBudgetKB"), c_QueryCacheBudgetKB,
+    TEXT("Memory budget for the query cache, in kilobytes. Least recently used results are evicted past this.\n"),
+    ECVF_Default);
+
+// Adaptive query rate. Sources are sorted into distance tiers, and each tier is queried every N frames.
+// Sources that haven't moved relative to the listener are only re-queried every c_QueryRateStaticInterval frames.
+// Between queries, parameters are blended from the previous results toward the latest ones.
+int32 c_AdaptiveQueryRate = 0;
+static FAutoConsoleVariableRef CVarAcousticsAdaptiveQueryRate(
+    TEXT("PA.AdaptiveQueryRate"), c_AdaptiveQueryRate,
+    TEXT("When non-zero, distant and stationary sources are queried less often than every frame.\n"),
+    ECVF_Default);
+
+float c_QueryRateNearDistance = 1500.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryRateNearDistance(
+    TEXT("PA.QueryRateNearDistance"), c_QueryRateNearDistance,
+    TEXT("Sources closer than this to the listener (Unreal units) use PA.QueryRateNearInterval.\n"),
+    ECVF_Default);
+
+float c_QueryRateFarDistance = 5000.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryRateFarDistance(
+    TEXT("PA.QueryRateFarDistance"), c_QueryRateFarDistance,
+    TEXT("Sources further than this from the listener (Unreal units) use PA.QueryRateFarInterval.\n")
+        TEXT("Sources in between use PA.QueryRateMidInterval.\n"),
+    ECVF_Default);
+
+int32 c_QueryRateNearInterval = 1;
+static FAutoConsoleVariableRef CVarAcousticsQueryRateNearInterval(
+    TEXT("PA.QueryRateNearInterval"), c_QueryRateNearInterval,
+    TEXT("Frames between queries for near sources.\n"),
+    ECVF_Default);
+
+int32 c_QueryRateMidInterval = 2;
+static FAutoConsoleVariableRef CVarAcousticsQueryRateMidInterval(
+    TEXT("PA.QueryRateMidInterval"), c_QueryRateMidInterval,
+    TEXT("Frames between queries for sources between the near and far distances.\n"),
+    ECVF_Default);
+
+int32 c_QueryRateFarInterval = 8;
+static FAutoConsoleVariableRef CVarAcousticsQueryRateFarInterval(
+    TEXT("PA.QueryRateFarInterval"), c_QueryRateFarInterval,
+    TEXT("Frames between queries for far sources.\n"),
+    ECVF_Default);
+
+float c_QueryRateMotionThreshold = 5.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryRateMotionThreshold(
+    TEXT("PA.QueryRateMotionThreshold"), c_QueryRateMotionThreshold,
+    TEXT("A source counts as stationary if neither it nor the listener has moved more than this (Unreal units)\n")
+        TEXT("since its last query.\n"),
+    ECVF_Default);
+
+int32 c_QueryRateStaticInterval = 30;
+static FAutoConsoleVariableRef CVarAcousticsQueryRateStaticInterval(
+    TEXT("PA.QueryRateStaticInterval"), c_QueryRateStaticInterval,
+    TEXT("Frames between queries for stationary sources. Keeps them up to date with streaming and openings.\n"),
+    ECVF_Default);
+
+// Per-frame budget for background queries, in microseconds of query time. When set, queries are collected as sources
+// update and dispatched from PostTick, highest priority first, until the budget is used up. The rest carry over.
+// 0 disables the budget, and queries are dispatched as soon as sources update.
+float c_QueryBudgetUs = 0.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryBudgetUs(
+    TEXT("PA.QueryBudgetUs"), c_QueryBudgetUs,
+    TEXT("Per-frame budget for background acoustic queries, in microseconds. Queries over budget carry over to\n")
+        TEXT("the next frame. 0 disables the budget.\n"),
+    ECVF_Default);
+
+// Priority boost per frame a query has been waiting. Louder sources go first, but anything left waiting long
+// enough will outrank them, so no source starves.
+float c_QueryBudgetAgeWeightDb = 6.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryBudgetAgeWeightDb(
+    TEXT("PA.QueryBudgetAgeWeightDb"), c_QueryBudgetAgeWeightDb,
+    TEXT("Priority boost, in dB of audibility, for each frame a budgeted query has been waiting.\n"),
+    ECVF_Default);
+
+// Assumed cost of one query until real ones have been measured
+constexpr float c_DefaultQueryMicroseconds = 50.0f;
+
+// Outdoorness is only recomputed once the listener has moved this far (Unreal units), or the loaded region changes
+float c_OutdoornessMoveThreshold = 50.0f;
+static FAutoConsoleVariableRef CVarAcousticsOutdoornessMoveThreshold(
+    TEXT("PA.OutdoornessMoveThreshold"), c_OutdoornessMoveThreshold,
+    TEXT("Distance the listener must move (Unreal units) before outdoorness is recomputed.\n"),
+    ECVF_Default);
+
+// Batched queries are split into chunks of at least this many sources, one chunk per query worker
+constexpr int32 c_MinQueryBatchChunkSize = 64;
+
 // Computed outdoorness is 0 only if player is completely enclosed
 // and 1 only when player is standing on a flat plane with no other geometry.
 // These constants bring the range closer to practically observed values.
@@ -52,22 +228,40 @@ FProjectAcousticsModule::FProjectAcousticsModule()
     , m_AceFileLoaded(false)
     , m_LastLoadCenterPosition(0, 0, 0)
     , m_LastLoadTileSize(0, 0, 0)
-    , m_IsOutdoornessStale(true)
     , m_CachedOutdoorness(0)
+    , m_OutdoornessRequestLocation(0, 0, 0)
+    , m_OutdoornessRequestGeneration(0)
+    , m_OutdoornessListenerLocation(0, 0, 0)
+    , m_OutdoornessRegionGeneration(0)
+    , m_HasOutdoorness(false)
+    , m_RegionGeneration(0)
     , m_GlobalDesign(FAcousticsDesignParams::Default())
-    , m_NumRunningTasks(0)
+    , m_LastCompletedLoadTasks(0)
+    , m_EvictionCompletedTasks(0)
+    , m_EvictionFrame(0)
+    , m_HasWarnedOverBudget(false)
+    , m_BatchChunkSize(0)
+    , m_NumBatchChunks(0)
+    , m_HasBatchToCollect(false)
+    , m_QueryFrame(0)
+    , m_QueryCycles(0)
+    , m_QueryCount(0)
+    , m_AverageQueryMicroseconds(c_DefaultQueryMicroseconds)
 {
 #if !UE_BUILD_SHIPPING
     m_IsEnabled = true;
 #endif
-    // Create a threadpool of 1, so that we know that all queries will happen one at a time, from a single thread
-    m_ThreadPool = FQueuedThreadPool::Allocate();
-    m_ThreadPool->Create(1);
+    m_QueryScheduler.Create(c_NumQueryWorkers);
+    m_OutdoornessWork =
+        MakeUnique<FAcousticsQueuedWork>([this]() { ComputeOutdoorness(); }, &m_NumRunningTasks);
+    m_OpeningUpdateWork =
+        MakeUnique<FAcousticsQueuedWork>([this]() { ApplyOpeningUpdates(); }, &m_NumRunningTasks);
 }
 
 void FProjectAcousticsModule::StartupModule()
 {
-    m_TritonMemHook = TUniquePtr<FTritonMemHook>(new FTritonMemHook());
+    m_TritonMemHook = c_PooledMemory != 0 ? TUniquePtr<FTritonMemHook>(new FTritonPooledMemHook())
+                                          : TUniquePtr<FTritonMemHook>(new FTritonMemHook());
     m_TritonLogHook = TUniquePtr<FTritonLogHook>(new FTritonLogHook());
     auto initSuccess = TritonAcoustics::Init(m_TritonMemHook.Get(), m_TritonLogHook.Get());
     if (!initSuccess)
@@ -100,6 +294,7 @@ void FProjectAcousticsModule::ShutdownModule()
     {
         // Make sure there are no lingering background queries still running
         WaitForRunningTasks();
+        m_QueryScheduler.Destroy();
 
         TritonAcoustics::DestroyInstance(m_Triton);
         TritonAcoustics::TearDown();
@@ -120,12 +315,37 @@ bool FProjectAcousticsModule::LoadAceFile(const FString& filePath, const float c
 
     UnloadAceFile(false);
 
+    // Nothing is queued between loads, so this is a safe point to pick up a change in worker count
+    if (c_NumQueryWorkers != m_QueryScheduler.GetNumWorkers() && m_NumRunningTasks.GetCount() == 0)
+    {
+        m_QueryScheduler.Create(c_NumQueryWorkers);
+    }
+
     auto fullFilePath = FPaths::ProjectDir() + filePath;
     {
         SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadAce);
         // Load the ACE file
-        m_TritonIOHook = TUniquePtr<FTritonUnrealIOHook>(new FTritonUnrealIOHook());
-        if (!m_TritonIOHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath)))
+        bool isOpen = false;
+        if (c_AceIOMode == 1)
+        {
+            m_TritonIOHook = TUniquePtr<FTritonMappedIOHook>(new FTritonMappedIOHook());
+            isOpen = m_TritonIOHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath));
+            if (!isOpen)
+            {
+                // Most likely packaged into a PAK file
+                UE_LOG(
+                    LogAcousticsRuntime,
+                    Log,
+                    TEXT("Couldn't memory-map ACE file [%s], reading it through the file cache instead"),
+                    *fullFilePath);
+            }
+        }
+        if (!isOpen)
+        {
+            m_TritonIOHook = TUniquePtr<FTritonUnrealIOHook>(new FTritonUnrealIOHook());
+            isOpen = m_TritonIOHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath));
+        }
+        if (!isOpen)
         {
             m_TritonIOHook.Reset();
 
@@ -133,7 +353,32 @@ bool FProjectAcousticsModule::LoadAceFile(const FString& filePath, const float c
             return false;
         }
 
+#if !UE_BUILD_SHIPPING
+        if (c_AceIOTrace != 0)
+        {
+            const FString traceFilePath = FPaths::ProjectSavedDir() / TEXT("Acoustics") /
+                                          FString::Printf(
+                                              TEXT("%s-%s.paiotrace"),
+                                              *FPaths::GetBaseFilename(filePath),
+                                              *FDateTime::Now().ToString());
+            m_TritonIOHook = TUniquePtr<FTritonRecordingIOHook>(
+                new FTritonRecordingIOHook(MoveTemp(m_TritonIOHook), fullFilePath, traceFilePath));
+        }
+#endif
+
+        // Our hooks track 64-bit positions, but Triton still seeks to absolute 32-bit offsets through ITritonIOHook
+        if (m_TritonIOHook->GetFileSize() > static_cast<int64>(MAX_uint32))
+        {
+            UE_LOG(
+                LogAcousticsRuntime,
+                Warning,
+                TEXT("ACE file [%s] is larger than 4GB. Triton seeks with 32-bit offsets, so data past 4GB may fail "
+                     "to load"),
+                *fullFilePath);
+        }
+
         m_TritonTaskHook = TUniquePtr<FTritonAsyncTaskHook>(new FTritonAsyncTaskHook());
+        m_LastCompletedLoadTasks = 0;
         if (!m_Triton->InitLoad(m_TritonIOHook.Get(), m_TritonTaskHook.Get(), cacheScale))
         {
             UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file: [%s]"), *fullFilePath);
@@ -163,12 +408,36 @@ void FProjectAcousticsModule::UnloadAceFile(bool clearOldQueries)
         WaitForRunningTasks();
         if (clearOldQueries)
         {
-            m_AcousticQueryResultMap.Reset();
-            m_NumRunningTasks = 0;
+            FRWScopeLock lock(m_SourceSlotLock, SLT_Write);
+            m_FreeSourceSlots.Reset();
+            for (int32 i = 0; i < m_SourceSlots.Num(); i++)
+            {
+                m_SourceSlots[i]->Reset();
+                m_FreeSourceSlots.Add(i);
+            }
+            m_SourceSlotIndices.Reset();
+            {
+                FScopeLock pendingLock(&m_PendingQueryLock);
+                for (FAcousticsResultSlot* slot : m_PendingQueries)
+                {
+                    slot->IsQueryPending = false;
+                }
+                m_PendingQueries.Reset();
+            }
+            m_HasBatchToCollect = false;
         }
 
         SCOPE_CYCLE_COUNTER(STAT_Acoustics_ClearAce);
         m_Triton->Clear();
+        m_PendingLoad.Reset();
+        {
+            // Triton's openings were cleared with everything else. The work isn't running, it was waited on above
+            FScopeLock lock(&m_OpeningLock);
+            m_OpeningAttenuations.Reset();
+        }
+        m_QueryCache.Reset();
+        m_ProbeBudget.Reset();
+        OnLoadedRegionChanged();
         m_AceFileLoaded = false;
     }
 
@@ -215,18 +484,24 @@ bool FProjectAcousticsModule::AddDynamicOpening(
         return false;
     }
 
-    TArray<Triton::Vec3f> vertices;
+    FOpeningOp op;
+    op.Type = FOpeningOp::EType::Add;
+    op.Id = reinterpret_cast<uint64_t>(opening);
+    // Openings are named after their actor in logs
+    op.Name = opening->GetOwner() != nullptr ? opening->GetOwner()->GetFName() : opening->GetFName();
+    op.Center = AcousticsUtils::ToTritonVectorDouble(center);
+    op.Normal = AcousticsUtils::ToTritonVector(normal);
+    op.Vertices.Reserve(verticesIn.Num());
     for (auto& v : verticesIn)
     {
-        vertices.Add(AcousticsUtils::ToTritonVector(v));
+        op.Vertices.Add(AcousticsUtils::ToTritonVector(v));
     }
 
-    return m_Triton->AddDynamicOpening(
-        reinterpret_cast<uint64_t>(opening),
-        AcousticsUtils::ToTritonVectorDouble(center),
-        AcousticsUtils::ToTritonVector(normal),
-        vertices.Num(),
-        &vertices[0]);
+    // Queued behind any earlier change to this opening, such as its removal
+    FScopeLock lock(&m_OpeningLock);
+    m_PendingOpeningUpdates.Remove(op.Id);
+    m_PendingOpeningOps.Add(MoveTemp(op));
+    return true;
 }
 
 bool FProjectAcousticsModule::RemoveDynamicOpening(class UAcousticsDynamicOpening* opening)
@@ -236,7 +511,14 @@ bool FProjectAcousticsModule::RemoveDynamicOpening(class UAcousticsDynamicOpenin
         return false;
     }
 
-    return m_Triton->RemoveDynamicOpening(reinterpret_cast<uint64_t>(opening));
+    FOpeningOp op;
+    op.Type = FOpeningOp::EType::Remove;
+    op.Id = reinterpret_cast<uint64_t>(opening);
+
+    FScopeLock lock(&m_OpeningLock);
+    m_PendingOpeningUpdates.Remove(op.Id);
+    m_PendingOpeningOps.Add(MoveTemp(op));
+    return true;
 }
 
 bool FProjectAcousticsModule::UpdateDynamicOpening(
@@ -247,7 +529,105 @@ bool FProjectAcousticsModule::UpdateDynamicOpening(
         return false;
     }
 
-    return m_Triton->UpdateDynamicOpening(reinterpret_cast<uint64_t>(opening), dryAttenuationDb, wetAttenuationDb);
+    // Queued for the next PostTick. Only the latest value since the opening was last added or removed is kept
+    const uint64_t id = reinterpret_cast<uint64_t>(opening);
+    const FVector2f attenuation(dryAttenuationDb, wetAttenuationDb);
+    FScopeLock lock(&m_OpeningLock);
+    if (const int32* opIndex = m_PendingOpeningUpdates.Find(id))
+    {
+        m_PendingOpeningOps[*opIndex].Attenuation = attenuation;
+        return true;
+    }
+
+    FOpeningOp op;
+    op.Type = FOpeningOp::EType::Update;
+    op.Id = id;
+    op.Attenuation = attenuation;
+    m_PendingOpeningUpdates.Add(id, m_PendingOpeningOps.Add(MoveTemp(op)));
+    return true;
+}
+
+bool FProjectAcousticsModule::GetAppliedDynamicOpeningAttenuation(
+    class UAcousticsDynamicOpening* opening, float& outDryAttenuationDb, float& outWetAttenuationDb) const
+{
+    FScopeLock lock(&m_OpeningLock);
+    const FVector2f* attenuation = m_OpeningAttenuations.Find(reinterpret_cast<uint64_t>(opening));
+    if (attenuation == nullptr)
+    {
+        return false;
+    }
+    outDryAttenuationDb = attenuation->X;
+    outWetAttenuationDb = attenuation->Y;
+    return true;
+}
+
+void FProjectAcousticsModule::ApplyOpeningUpdates()
+{
+    TArray<FOpeningOp> ops;
+    {
+        FScopeLock lock(&m_OpeningLock);
+        ops = MoveTemp(m_PendingOpeningOps);
+        m_PendingOpeningOps.Reset();
+        m_PendingOpeningUpdates.Reset();
+    }
+
+    // Only this work calls into Triton for openings, and one batch is applied at a time, so applying them in the
+    // order they were queued keeps the order the game thread made them in, e.g. an opening removed and added again
+    // in one frame ends up added
+    for (const FOpeningOp& op : ops)
+    {
+        switch (op.Type)
+        {
+            case FOpeningOp::EType::Add:
+            {
+                // Starts over at Triton's default attenuation, so the opening has to send its own again
+                {
+                    FScopeLock lock(&m_OpeningLock);
+                    m_OpeningAttenuations.Remove(op.Id);
+                }
+                if (!m_Triton->AddDynamicOpening(op.Id, op.Center, op.Normal, op.Vertices.Num(), op.Vertices.GetData()))
+                {
+                    UE_LOG(
+                        LogAcousticsRuntime,
+                        Warning,
+                        TEXT("Dynamic opening [%s] failed to register with Acoustics. Disabled."),
+                        *op.Name.ToString());
+                }
+                m_QueryCache.InvalidateOpenings();
+                break;
+            }
+            case FOpeningOp::EType::Remove:
+            {
+                {
+                    FScopeLock lock(&m_OpeningLock);
+                    m_OpeningAttenuations.Remove(op.Id);
+                }
+                m_Triton->RemoveDynamicOpening(op.Id);
+                m_QueryCache.InvalidateOpenings();
+                break;
+            }
+            case FOpeningOp::EType::Update:
+            {
+                const FVector2f* lastAttenuation = m_OpeningAttenuations.Find(op.Id);
+                if (lastAttenuation != nullptr && *lastAttenuation == op.Attenuation)
+                {
+                    break;
+                }
+
+                // If Triton rejects the update, nothing is recorded, and the opening sends it again
+                if (m_Triton->UpdateDynamicOpening(op.Id, op.Attenuation.X, op.Attenuation.Y))
+                {
+                    {
+                        FScopeLock lock(&m_OpeningLock);
+                        m_OpeningAttenuations.Add(op.Id, op.Attenuation);
+                    }
+                    m_QueryCache.InvalidateOpenings();
+                }
+                INC_DWORD_STAT(STAT_Acoustics_OpeningUpdates);
+                break;
+            }
+        }
+    }
 }
 
 bool FProjectAcousticsModule::SetGlobalDesign(const FAcousticsDesignParams& params)
@@ -260,32 +640,48 @@ void FProjectAcousticsModule::SetSpaceTransform(const FTransform& newTransform)
 {
     m_SpaceTransform = newTransform;
     m_InverseSpaceTransform = m_SpaceTransform.Inverse();
+    // World positions now map to different places in the ACE file
+    OnLoadedRegionChanged();
 }
 
 AcousticQueryResults FProjectAcousticsModule::GetAcousticQueryResults(
     const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation, 
     AcousticsObjectParams objectParams)
 {
-    UpdateOutdoorness(listenerLocation);
-
     TritonAcousticParameters acousticParams = {};
     // Need to pass over the state of ApplyDynamicOpenings
     TritonDynamicOpeningInfo openingInfo = objectParams.DynamicOpeningInfo;
     InterpolationConfig interpConfig = objectParams.InterpolationConfig;
     AcousticQueryResults returnStruct = {};
 
+    // Cache hits skip Triton entirely, so they carry no query debug info
+    // The key is made before querying, so results from a query that overlapped a region or opening change are
+    // stored under the generation they were started in
+    const bool applyDynamicOpenings = openingInfo.ApplyDynamicOpening;
+    FAcousticsQueryCache::FKey cacheKey;
+    bool querySuccess = m_QueryCache.Find(
+        sourceLocation, listenerLocation, interpConfig, applyDynamicOpenings, acousticParams, openingInfo, cacheKey);
+
+    if (!querySuccess)
+    {
 #if !UE_BUILD_SHIPPING
-    TritonRuntime::QueryDebugInfo queryDebugInfo;
+        TritonRuntime::QueryDebugInfo queryDebugInfo;
 
-    bool querySuccess = GetAcousticParameters(
-        sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig, &queryDebugInfo);
+        querySuccess = GetAcousticParameters(
+            sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig, &queryDebugInfo);
 
-    returnStruct.QueryDebugInfo = queryDebugInfo;
+        returnStruct.QueryDebugInfo = queryDebugInfo;
 #else
-    bool querySuccess =
-        GetAcousticParameters(sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig);
+        querySuccess =
+            GetAcousticParameters(sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig);
 #endif // !UE_BUILD_SHIPPING
 
+        if (querySuccess)
+        {
+            m_QueryCache.Add(cacheKey, acousticParams, openingInfo);
+        }
+    }
+
     returnStruct.AcousticParams = acousticParams;
     returnStruct.OpeningInfo = openingInfo;
     returnStruct.QueryResult = querySuccess;
@@ -293,72 +689,273 @@ AcousticQueryResults FProjectAcousticsModule::GetAcousticQueryResults(
     return returnStruct;
 }
 
-void FProjectAcousticsModule::RegisterSourceObject(const uint64_t sourceObjectId)
+// Frames between queries for a source at the given distance from the listener
+static int32 GetQueryRateInterval(const float distance)
+{
+    if (distance <= c_QueryRateNearDistance)
+    {
+        return FMath::Max(c_QueryRateNearInterval, 1);
+    }
+    if (distance <= c_QueryRateFarDistance)
+    {
+        return FMath::Max(c_QueryRateMidInterval, 1);
+    }
+    return FMath::Max(c_QueryRateFarInterval, 1);
+}
+
+static ATKVectorF LerpDirection(const ATKVectorF& from, const ATKVectorF& to, const float alpha)
+{
+    FVector direction(
+        FMath::Lerp(from.x, to.x, alpha), FMath::Lerp(from.y, to.y, alpha), FMath::Lerp(from.z, to.z, alpha));
+    // Opposing directions blend through zero. Just snap to the target in that case
+    if (!direction.Normalize())
+    {
+        return to;
+    }
+    return ATKVectorF(
+        static_cast<float>(direction.X), static_cast<float>(direction.Y), static_cast<float>(direction.Z));
+}
+
+static TritonAcousticParameters LerpAcousticParameters(
+    const TritonAcousticParameters& from, const TritonAcousticParameters& to, const float alpha)
+{
+    TritonAcousticParameters result = to;
+    result.Dry.GeomDist = FMath::Lerp(from.Dry.GeomDist, to.Dry.GeomDist, alpha);
+    result.Dry.PathLengthMeters = FMath::Lerp(from.Dry.PathLengthMeters, to.Dry.PathLengthMeters, alpha);
+    result.Dry.LoudnessDb = FMath::Lerp(from.Dry.LoudnessDb, to.Dry.LoudnessDb, alpha);
+    result.Dry.ArrivalDirection = LerpDirection(from.Dry.ArrivalDirection, to.Dry.ArrivalDirection, alpha);
+    result.Wet.LoudnessDb = FMath::Lerp(from.Wet.LoudnessDb, to.Wet.LoudnessDb, alpha);
+    result.Wet.ArrivalDirection = LerpDirection(from.Wet.ArrivalDirection, to.Wet.ArrivalDirection, alpha);
+    result.Wet.AngularSpreadDegrees = FMath::Lerp(from.Wet.AngularSpreadDegrees, to.Wet.AngularSpreadDegrees, alpha);
+    result.Wet.DecayTimeSeconds = FMath::Lerp(from.Wet.DecayTimeSeconds, to.Wet.DecayTimeSeconds, alpha);
+    return result;
+}
+
+bool FProjectAcousticsModule::ShouldQuerySource(
+    const FAcousticsResultSlot& slot, const int32 frame, const FVector& sourceLocation,
+    const FVector& listenerLocation) const
+{
+    const int32 framesSinceQuery = frame - slot.LastQueryFrame;
+    if (framesSinceQuery < GetQueryRateInterval(FVector::Dist(sourceLocation, listenerLocation)))
+    {
+        return false;
+    }
+
+    const float thresholdSquared = FMath::Square(c_QueryRateMotionThreshold);
+    const bool hasMoved = FVector::DistSquared(sourceLocation, slot.LastQuerySourceLocation) > thresholdSquared ||
+                          FVector::DistSquared(listenerLocation, slot.LastQueryListenerLocation) > thresholdSquared;
+    return hasMoved || framesSinceQuery >= FMath::Max(c_QueryRateStaticInterval, 1);
+}
+
+// Remember where and when a source was last queried, for the adaptive query rate
+static void MarkSourceQueried(
+    FAcousticsResultSlot& slot, const int32 frame, const FVector& sourceLocation, const FVector& listenerLocation)
+{
+    slot.LastQuerySourceLocation = sourceLocation;
+    slot.LastQueryListenerLocation = listenerLocation;
+    slot.LastQueryInterval = FMath::Max(frame - slot.LastQueryFrame, 1);
+    slot.LastQueryFrame = frame;
+}
+
+// Dry loudness at the last query, attenuated by distance
+static float GetQueryAudibilityDb(
+    const FAcousticsResultSlot& slot, const FVector& sourceLocation, const FVector& listenerLocation)
+{
+    const float distanceMeters =
+        FMath::Max(AcousticsUtils::UnrealValToTriton(FVector::Dist(sourceLocation, listenerLocation)), 1.0);
+    const float loudnessDb = (slot.HasLastResults && slot.LastResults.QueryResult)
+                                 ? slot.LastResults.AcousticParams.Dry.LoudnessDb
+                                 : 0.0f;
+    return loudnessDb - 20.0f * FMath::LogX(10.0f, distanceMeters);
+}
+
+void FProjectAcousticsModule::DeferSourceQuery(
+    FAcousticsResultSlot& slot, const int32 frame, const uint64_t sourceObjectId, const FVector& sourceLocation,
+    const FVector& listenerLocation, const AcousticsObjectParams& objectParams)
+{
+    FScopeLock lock(&m_PendingQueryLock);
+
+    // PostTick may have dispatched it since the caller checked
+    if (FPlatformAtomics::AtomicRead(&slot.QueuedWork.m_IsQueuedOrRunning))
+    {
+        return;
+    }
+
+    // If a query is already waiting, just bring its request up to date. It keeps its place in line
+    slot.QueuedWork.SetRequest(
+        sourceObjectId, sourceLocation, listenerLocation, objectParams, FPlatformAtomics::AtomicRead(&slot.Generation));
+    slot.QueryAudibilityDb = GetQueryAudibilityDb(slot, sourceLocation, listenerLocation);
+    if (!slot.IsQueryPending)
+    {
+        slot.IsQueryPending = true;
+        slot.PendingSinceFrame = frame;
+        MarkSourceQueried(slot, frame, sourceLocation, listenerLocation);
+        m_PendingQueries.Add(&slot);
+    }
+}
+
+void FProjectAcousticsModule::CancelPendingQuery(FAcousticsResultSlot& slot)
+{
+    FScopeLock lock(&m_PendingQueryLock);
+    if (slot.IsQueryPending)
+    {
+        slot.IsQueryPending = false;
+        m_PendingQueries.RemoveSingleSwap(&slot);
+    }
+}
+
+void FProjectAcousticsModule::DispatchPendingQueries(const int32 frame)
 {
-    FScopeLock lock(&m_AcousticQueryResultMapLock);
+    FScopeLock lock(&m_PendingQueryLock);
+    SET_DWORD_STAT(STAT_Acoustics_PendingQueries, m_PendingQueries.Num());
+    if (m_PendingQueries.Num() == 0)
+    {
+        return;
+    }
+
+    // Always dispatch at least one, so the queue drains even if the budget is smaller than a single query
+    int32 numToDispatch = m_PendingQueries.Num();
+    if (c_QueryBudgetUs > 0.0f)
+    {
+        const int32 affordable = FMath::FloorToInt(c_QueryBudgetUs / FMath::Max(m_AverageQueryMicroseconds, 1.0f));
+        numToDispatch = FMath::Clamp(affordable, 1, m_PendingQueries.Num());
+    }
 
-    // Re-use the old result if it exists. Just don't reset the QueuedWork, because it could still be running
-    AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
+    if (numToDispatch < m_PendingQueries.Num())
+    {
+        const float ageWeightDb = c_QueryBudgetAgeWeightDb;
+        m_PendingQueries.Sort(
+            [frame, ageWeightDb](const FAcousticsResultSlot& a, const FAcousticsResultSlot& b)
+            {
+                return (a.QueryAudibilityDb + ageWeightDb * (frame - a.PendingSinceFrame)) >
+                       (b.QueryAudibilityDb + ageWeightDb * (frame - b.PendingSinceFrame));
+            });
+    }
 
-    if (result.QueuedWork.IsValid())
+    for (int32 i = 0; i < numToDispatch; i++)
     {
-        // There could be an old query running that hasn't finished. Attempt to retract it
-        auto retracted = m_ThreadPool->RetractQueuedWork(result.QueuedWork.Get());
+        FAcousticsResultSlot& slot = *m_PendingQueries[i];
+        slot.IsQueryPending = false;
+        slot.QueuedWork.SignalStart();
+        m_QueryScheduler.AddQueuedWork(slot.QueuedWork.m_SourceObjectId, &slot.QueuedWork);
+    }
+    m_PendingQueries.RemoveAt(0, numToDispatch, EAllowShrinking::No);
+}
 
-        // If retraction fails, it could be because the task is running. Setting RetractionRequested to true 
-        // to indicate to the running task not to store its irrelevant results.
-        result.RetractionRequested = true;
+void FProjectAcousticsModule::SmoothQueryResults(
+    FAcousticsResultSlot& slot, const int32 frame, const bool isNewResult, AcousticQueryResults& inOutResults)
+{
+    if (isNewResult)
+    {
+        // Blend in from wherever the last returned parameters were, over about as many frames as this query took
+        // to come around, so the source doesn't step every time a decimated query lands
+        const bool canBlend = slot.HasLastResults && slot.LastResults.QueryResult && inOutResults.QueryResult;
+        slot.InterpFrom = slot.LastReturnedParams;
+        slot.InterpStartFrame = frame;
+        slot.InterpFrames = canBlend ? slot.LastQueryInterval : 1;
+        slot.LastResults = inOutResults;
+        slot.HasLastResults = true;
+    }
+    else if (slot.HasLastResults)
+    {
+        inOutResults = slot.LastResults;
+    }
+    else
+    {
+        return;
+    }
 
-        if (retracted)
+    if (inOutResults.QueryResult)
+    {
+        const float alpha =
+            FMath::Min(static_cast<float>(frame - slot.InterpStartFrame + 1) / slot.InterpFrames, 1.0f);
+        if (alpha < 1.0f)
         {
-            // Retracted tasks don't get abandoned. We need to do it.
-            result.QueuedWork->Abandon();
-            result.QueuedWork.Reset();
+            inOutResults.AcousticParams =
+                LerpAcousticParameters(slot.InterpFrom, slot.LastResults.AcousticParams, alpha);
         }
+        slot.LastReturnedParams = inOutResults.AcousticParams;
     }
+}
 
-    result.QueryResults = TFuture<AcousticQueryResults>();
-    result.HasProcessed = false;
+FAcousticsResultSlot* FProjectAcousticsModule::FindSourceSlot(const uint64_t sourceObjectId)
+{
+    // Caller must hold m_SourceSlotLock
+    const int32* index = m_SourceSlotIndices.Find(sourceObjectId);
+    return index != nullptr ? m_SourceSlots[*index].Get() : nullptr;
 }
 
-void FProjectAcousticsModule::UnregisterSourceObject(const uint64_t sourceObjectId)
+bool FProjectAcousticsModule::RetractSourceQuery(FAcousticsResultSlot& slot)
 {
-    FScopeLock lock(&m_AcousticQueryResultMapLock);
+    if (FPlatformAtomics::AtomicRead(&slot.QueuedWork.m_IsQueuedOrRunning) == 0)
+    {
+        return true;
+    }
+
+    if (m_QueryScheduler.RetractQueuedWork(slot.SourceObjectId, &slot.QueuedWork))
+    {
+        // Retracted tasks don't get abandoned. We need to do it.
+        slot.QueuedWork.Abandon();
+        return true;
+    }
+
+    // If retraction fails, it could be because the task is running. The caller resets the slot's generation so
+    // that the running task doesn't store its irrelevant results.
+    return FPlatformAtomics::AtomicRead(&slot.QueuedWork.m_IsQueuedOrRunning) == 0;
+}
 
-    if (m_AcousticQueryResultMap.Contains(sourceObjectId))
+void FProjectAcousticsModule::RegisterSourceObject(const uint64_t sourceObjectId)
+{
+    FRWScopeLock lock(m_SourceSlotLock, SLT_Write);
+
+    // Re-use the old slot if it exists. There could be an old query running that hasn't finished
+    FAcousticsResultSlot* slot = FindSourceSlot(sourceObjectId);
+    if (slot != nullptr)
     {
-        AsyncAcousticQueryResults& queryObject = m_AcousticQueryResultMap[sourceObjectId];
-        if (queryObject.QueuedWork.IsValid())
+        CancelPendingQuery(*slot);
+        RetractSourceQuery(*slot);
+    }
+    else
+    {
+        // Take a free slot, as long as nothing from its previous source is still queued or running on it
+        int32 slotIndex = INDEX_NONE;
+        for (int32 i = 0; i < m_FreeSourceSlots.Num(); i++)
         {
-            auto queuedWorkPtr = queryObject.QueuedWork.Get();
-
-            // A query for this source may still be queued. We want to retract it if we can so that it doesn't return
-            // results later. If it was successfully retracted, we can safely remove it from the map. Or, if we know
-            // it's not queued or running, we can remove it. Otherwise, it's possible it's in the running state and we
-            // can't touch it yet. It will eventually be cleaned up during shutdown, where we do wait for tasks to
-            // finish
-            auto retracted = m_ThreadPool->RetractQueuedWork(queuedWorkPtr);
-            auto isQueuedOrRunning = FPlatformAtomics::AtomicRead(&queuedWorkPtr->m_IsQueuedOrRunning);
-
-            // If retraction fails, it could be because the task is running. Setting RetractionRequested to true 
-            // to indicate to the running task not to store its irrelevant results.
-            queryObject.RetractionRequested = true;
-            
-            if (retracted || (isQueuedOrRunning == 0))
+            if (RetractSourceQuery(*m_SourceSlots[m_FreeSourceSlots[i]]))
             {
-                if (retracted)
-                {
-                    // Retracted tasks don't get abandoned. We need to do it.
-                    queuedWorkPtr->Abandon();
-                    queryObject.QueuedWork.Reset();
-                }
-                m_AcousticQueryResultMap.Remove(sourceObjectId);
+                slotIndex = m_FreeSourceSlots[i];
+                m_FreeSourceSlots.RemoveAtSwap(i);
+                break;
             }
         }
-        else
+        if (slotIndex == INDEX_NONE)
         {
-            m_AcousticQueryResultMap.Remove(sourceObjectId);
+            slotIndex = m_SourceSlots.Add(MakeUnique<FAcousticsResultSlot>(this, &m_NumRunningTasks));
         }
+
+        m_SourceSlotIndices.Add(sourceObjectId, slotIndex);
+        slot = m_SourceSlots[slotIndex].Get();
+        slot->SourceObjectId = sourceObjectId;
+    }
+
+    slot->Reset();
+}
+
+void FProjectAcousticsModule::UnregisterSourceObject(const uint64_t sourceObjectId)
+{
+    FRWScopeLock lock(m_SourceSlotLock, SLT_Write);
+
+    int32 slotIndex = INDEX_NONE;
+    if (m_SourceSlotIndices.RemoveAndCopyValue(sourceObjectId, slotIndex))
+    {
+        // A query for this source may still be queued. We want to retract it if we can so that it doesn't return
+        // results later. If it's already running, the new generation makes it drop its results, and the slot isn't
+        // handed out again until it has finished
+        FAcousticsResultSlot& slot = *m_SourceSlots[slotIndex];
+        CancelPendingQuery(slot);
+        RetractSourceQuery(slot);
+        slot.Reset();
+        m_FreeSourceSlots.Add(slotIndex);
     }
 }
 
@@ -379,65 +976,70 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
         return false;
     }
     // Get acoustic parameters from Triton. Pass failure on to caller, caller should re-use previous acoustic parameters
-    TritonAcousticParameters acousticParams = {};
-    TritonDynamicOpeningInfo openingInfo = {};
-    TritonRuntime::QueryDebugInfo queryDebugInfo = {};
+    AcousticQueryResults queryResults = {};
 
     // We want to most acoustic queries on a background thread. So for each update call on a source, we will return any
     // past results and queue up a query to run in the background and be ready for the next call.
     bool alreadyStoredResult = false;
-    bool querySuccess = false;
-
-    // Need to have a lock on the result map because both background threads and the audio/game thread will be accessing
-    // it
-    m_AcousticQueryResultMapLock.Lock();
 
-    // Check if we have past results for this source
-    if (m_AcousticQueryResultMap.Contains(sourceObjectId))
     {
-        // Have the results been saved?
-        if (m_AcousticQueryResultMap[sourceObjectId].QueryResults.IsReady())
+        // Only a read lock, so updates for different sources don't wait on each other. Results are taken from the
+        // source's slot without blocking on the background thread publishing into it
+        FRWScopeLock lock(m_SourceSlotLock, SLT_ReadOnly);
+        FAcousticsResultSlot* slot = FindSourceSlot(sourceObjectId);
+        if (slot == nullptr)
         {
-            // Results are ready. Get them and use their values
-            auto results = m_AcousticQueryResultMap[sourceObjectId].QueryResults.Get();
-            acousticParams = results.AcousticParams;
-            openingInfo = results.OpeningInfo;
-            querySuccess = results.QueryResult;
-#if !UE_BUILD_SHIPPING
-            queryDebugInfo = results.QueryDebugInfo;
-#endif
-            m_AcousticQueryResultMap[sourceObjectId].QueryResults.Reset();
+            UE_LOG(
+                LogAcousticsRuntime,
+                Error,
+                TEXT("No result slot found for source:%d. This most likely means this source "
+                     "did not register first (RegisterSourceObject) before updating."), sourceObjectId);
+            return false;
+        }
+
+        const bool adaptiveQueryRate = c_AdaptiveQueryRate != 0;
+        const bool queryBudgetActive = c_QueryBudgetUs > 0.0f;
+        // Sources may go a frame or more without a new result. Keep their latest ones around to fall back on
+        const bool keepLastResults = adaptiveQueryRate || queryBudgetActive;
+        const int32 frame = FPlatformAtomics::AtomicRead(&m_QueryFrame);
+
+        // Check if we have past results for this source
+        if (slot->Take(queryResults))
+        {
+            slot->HasProcessed = true;
+            if (keepLastResults)
+            {
+                SmoothQueryResults(*slot, frame, true, queryResults);
+            }
         }
         // This is the first time this source is being processed. Run the first acoustic query call directly on this
         // calling thread
-        else if (!m_AcousticQueryResultMap[sourceObjectId].HasProcessed)
+        else if (!slot->HasProcessed)
         {
-            // We don't want to hold the map lock while we're calling Triton though
-            m_AcousticQueryResultMapLock.Unlock();
-
             // Do the query now
-            auto results = GetAcousticQueryResults(sourceObjectId, sourceLocation, listenerLocation, objectParams);
-            // Save the results
-            acousticParams = results.AcousticParams;
-            openingInfo = results.OpeningInfo;
-            querySuccess = results.QueryResult;
-#if !UE_BUILD_SHIPPING
-            queryDebugInfo = results.QueryDebugInfo;
-#endif
+            queryResults = GetAcousticQueryResults(sourceObjectId, sourceLocation, listenerLocation, objectParams);
 
-            // Get the map lock back and then store these results in the map, so that the 2nd query will have something
-            // ready. Normal background queries will resume the 2nd time around
-            m_AcousticQueryResultMapLock.Lock();
-            TPromise<AcousticQueryResults> newPromise;
-            newPromise.SetValue(results);
-
-            // Re-use the existing result. Don't reset the QueuedWork, which still could be running.
-            AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
-            result.QueryResults = newPromise.GetFuture();
-            result.HasProcessed = true;
+            // Store these results in the slot, so that the 2nd query will have something ready. Normal background
+            // queries will resume the 2nd time around
+            slot->Publish(queryResults, FPlatformAtomics::AtomicRead(&slot->Generation));
+            slot->HasProcessed = true;
+            MarkSourceQueried(*slot, frame, sourceLocation, listenerLocation);
+            slot->LastQueryInterval = 1;
 
             alreadyStoredResult = true;
         }
+        // With the adaptive query rate or query budget, a source may simply not have been queried last frame. Keep
+        // returning (and blending toward) its latest results
+        else if (keepLastResults && slot->HasLastResults)
+        {
+            SmoothQueryResults(*slot, frame, false, queryResults);
+        }
+        // The last background query missed the deadline and was dropped. That's expected under load, so quietly
+        // return the latest results again
+        else if (FPlatformAtomics::InterlockedExchange(&slot->QueryDropped, 0) != 0)
+        {
+            slot->TakeLatest(queryResults);
+        }
         else
         {
             // No results were ready and this is not the first time this source has been processed. This probably means
@@ -449,82 +1051,53 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
                      "did not complete in time."),
                 sourceObjectId);
         }
-    }
-    else
-    {
-        UE_LOG(
-            LogAcousticsRuntime,
-            Error,
-            TEXT("No key found in the acoustic query map for source:%d. This most likely means this source "
-                 "did not register first (RegisterSourceObject) before updating."), sourceObjectId);
-        m_AcousticQueryResultMapLock.Unlock();
-        return false;
-    }
-    m_AcousticQueryResultMapLock.Unlock();
-
-    // Queue up the query to run on the background thread.
-    // Don't do this if we already stored the results
 
-    if (!alreadyStoredResult)
-    {
-        // Function to perform an acoustic query on a separate thread and save the result to the local map
-        TFunction<void()> RunBackgroundAcousticsQuery(
-            [this, sourceObjectId, sourceLocation, listenerLocation, objectParams]()
-            {
-                // Run the acoustic query
-                auto results = GetAcousticQueryResults(
-                    sourceObjectId,
-                    sourceLocation,
-                    listenerLocation,
-                    objectParams);
-
-                FScopeLock lock(&m_AcousticQueryResultMapLock);
-                if (m_AcousticQueryResultMap.Contains(sourceObjectId))
-                {
-                    AsyncAcousticQueryResults& result = m_AcousticQueryResultMap[sourceObjectId];
-                    if (result.RetractionRequested)
-                    {
-                        // This task was attempted to be retracted but wasn't able to be. We don't want to store
-                        // these results. Exit early.
-                        result.RetractionRequested = false;
-                        return;
-                    }
-
-                    // Store the promise/future in the map for retrieval on the next update pass
-                    TPromise<AcousticQueryResults> newPromise;
-                    newPromise.SetValue(results);
-
-                    result.HasProcessed = true;
-                    result.QueryResults = newPromise.GetFuture();
-                }
-            });
-
-        m_AcousticQueryResultMapLock.Lock();
-        AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
-
-        // If the last query is still running, we don't want to schedule a new one and fall behind. Skip the 
+        // Queue up the query to run on the background thread.
+        // Don't do this if we already stored the results.
+        // If the last query is still running, we don't want to schedule a new one and fall behind. Skip the
         // scheduling, and try again next pass.
-        auto queryStillRunning =
-            result.QueuedWork.IsValid() ? FPlatformAtomics::AtomicRead(&result.QueuedWork->m_IsQueuedOrRunning) : 0;
-        if (!queryStillRunning)
+        auto queryStillRunning = FPlatformAtomics::AtomicRead(&slot->QueuedWork.m_IsQueuedOrRunning);
+        bool shouldQuery = !alreadyStoredResult && !queryStillRunning;
+        if (shouldQuery && adaptiveQueryRate && !ShouldQuerySource(*slot, frame, sourceLocation, listenerLocation))
         {
-            // Queue up the acoustic query
-            result.RetractionRequested = false;
+            INC_DWORD_STAT(STAT_Acoustics_QueriesSkipped);
+            shouldQuery = false;
+        }
 
-            // Save the QueuedWork item in case we want to retract it later
-            result.QueuedWork = TUniquePtr<FAcousticsQueuedWork>(
-                new FAcousticsQueuedWork(MoveTemp(RunBackgroundAcousticsQuery), &m_NumRunningTasks));
+        if (shouldQuery && queryBudgetActive)
+        {
+            // Dispatched from PostTick, in priority order, as the frame's budget allows
+            DeferSourceQuery(*slot, frame, sourceObjectId, sourceLocation, listenerLocation, objectParams);
+        }
+        else if (shouldQuery)
+        {
+            // The slot's work item is idle, so it's safe to fill in the new request. The work publishes into the
+            // slot when it's done
+            FAcousticsSourceQueryWork& work = slot->QueuedWork;
+            work.SetRequest(
+                sourceObjectId, sourceLocation, listenerLocation, objectParams,
+                FPlatformAtomics::AtomicRead(&slot->Generation));
+            MarkSourceQueried(*slot, frame, sourceLocation, listenerLocation);
 
             // Signal that we've queued this item
-            result.QueuedWork->SignalStart();
+            work.SignalStart();
 
-            // Add our query to the queue
-            m_ThreadPool->AddQueuedWork(result.QueuedWork.Get());
+            // Add our query to the queue of the worker that owns this source
+            m_QueryScheduler.AddQueuedWork(sourceObjectId, &work);
         }
-        m_AcousticQueryResultMapLock.Unlock();
     }
 
+    return FinalizeObjectParameters(sourceObjectId, sourceLocation, listenerLocation, queryResults, objectParams);
+}
+
+bool FProjectAcousticsModule::FinalizeObjectParameters(
+    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+    const AcousticQueryResults& queryResults, AcousticsObjectParams& objectParams)
+{
+    const bool querySuccess = queryResults.QueryResult;
 #if !UE_BUILD_SHIPPING
+    const TritonRuntime::QueryDebugInfo& queryDebugInfo = queryResults.QueryDebugInfo;
+
     if (!querySuccess)
     {
         // Even if query fails, we want to catch that debug information before exiting this function
@@ -558,11 +1131,11 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
 
     // Set the remaining fields apart from design
     objectParams.ObjectId = sourceObjectId;
-    objectParams.TritonParams = acousticParams;
-    objectParams.DynamicOpeningInfo = openingInfo;
+    objectParams.TritonParams = queryResults.AcousticParams;
+    objectParams.DynamicOpeningInfo = queryResults.OpeningInfo;
     // Outdoorness value is shared across all emitters since it depends only on
     // listener location (for now), fill in that shared value.
-    objectParams.Outdoorness = m_CachedOutdoorness;
+    objectParams.Outdoorness = GetOutdoorness();
 
 #if !UE_BUILD_SHIPPING
     // If acoustics is disabled, intercept parameters headed to DSP
@@ -586,6 +1159,128 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
     return true;
 }
 
+bool FProjectAcousticsModule::SubmitQueryBatch(TArrayView<const FAcousticsQueryRequest> requests)
+{
+    if (!m_Triton || !m_AceFileLoaded)
+    {
+        return false;
+    }
+
+    // The one lock taken for the whole batch. Background chunks only touch their own slice of the batch arrays
+    FScopeLock lock(&m_QueryBatchLock);
+
+    // Like the per-source path, don't fall behind by stacking up batches. Caller tries again next frame
+    if (IsQueryBatchRunning())
+    {
+        return false;
+    }
+
+    const int32 numRequests = requests.Num();
+    m_BatchRequests.Reset();
+    m_BatchRequests.Append(requests.GetData(), numRequests);
+    // Reset() keeps the allocation, so steady-state batches of a similar size don't allocate. Every result starts out
+    // failed, so a request a chunk never got to is reported as such rather than as whatever was in memory
+    const AcousticQueryResults noResult = {};
+    m_BatchQueryResults.Reset();
+    m_BatchQueryResults.Reserve(numRequests);
+    for (int32 i = 0; i < numRequests; i++)
+    {
+        m_BatchQueryResults.Add(noResult);
+    }
+    m_HasBatchToCollect = true;
+
+    if (numRequests == 0)
+    {
+        m_NumBatchChunks = 0;
+        return true;
+    }
+
+    // Split into at most one chunk per worker, but don't bother splitting small batches
+    const int32 maxChunks = FMath::DivideAndRoundUp(numRequests, c_MinQueryBatchChunkSize);
+    m_NumBatchChunks = FMath::Clamp(maxChunks, 1, m_QueryScheduler.GetNumWorkers());
+    m_BatchChunkSize = FMath::DivideAndRoundUp(numRequests, m_NumBatchChunks);
+
+    // Work items are created once per chunk slot and re-used for every subsequent batch
+    while (m_BatchWork.Num() < m_NumBatchChunks)
+    {
+        const int32 chunkIndex = m_BatchWork.Num();
+        TFunction<void()> RunChunk([this, chunkIndex]() { RunQueryBatchChunk(chunkIndex); });
+        m_BatchWork.Emplace(new FAcousticsQueuedWork(MoveTemp(RunChunk), &m_NumRunningTasks));
+    }
+
+    for (int32 chunkIndex = 0; chunkIndex < m_NumBatchChunks; chunkIndex++)
+    {
+        auto* work = m_BatchWork[chunkIndex].Get();
+        work->SignalStart();
+        // Chunk index as the shard key spreads the chunks across workers
+        m_QueryScheduler.AddQueuedWork(static_cast<uint64_t>(chunkIndex), work);
+    }
+
+    return true;
+}
+
+bool FProjectAcousticsModule::CollectQueryBatch(TArrayView<FAcousticsQueryResult> outResults)
+{
+    FScopeLock lock(&m_QueryBatchLock);
+
+    if (!m_HasBatchToCollect || IsQueryBatchRunning())
+    {
+        return false;
+    }
+
+    const int32 numRequests = m_BatchRequests.Num();
+    if (outResults.Num() < numRequests)
+    {
+        UE_LOG(
+            LogAcousticsRuntime,
+            Error,
+            TEXT("CollectQueryBatch was given room for %d results, but %d queries were submitted."),
+            outResults.Num(),
+            numRequests);
+        return false;
+    }
+
+    for (int32 i = 0; i < numRequests; i++)
+    {
+        const auto& request = m_BatchRequests[i];
+        auto& result = outResults[i];
+        result.ObjectParams = request.ObjectParams;
+        result.Success = FinalizeObjectParameters(
+            request.SourceObjectId,
+            request.SourceLocation,
+            request.ListenerLocation,
+            m_BatchQueryResults[i],
+            result.ObjectParams);
+    }
+
+    m_HasBatchToCollect = false;
+    return true;
+}
+
+bool FProjectAcousticsModule::IsQueryBatchRunning() const
+{
+    for (int32 i = 0; i < m_NumBatchChunks; i++)
+    {
+        if (FPlatformAtomics::AtomicRead(&m_BatchWork[i]->m_IsQueuedOrRunning) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FProjectAcousticsModule::RunQueryBatchChunk(int32 chunkIndex)
+{
+    const int32 begin = chunkIndex * m_BatchChunkSize;
+    const int32 end = FMath::Min(begin + m_BatchChunkSize, m_BatchRequests.Num());
+    for (int32 i = begin; i < end; i++)
+    {
+        const auto& request = m_BatchRequests[i];
+        m_BatchQueryResults[i] = GetAcousticQueryResults(
+            request.SourceObjectId, request.SourceLocation, request.ListenerLocation, request.ObjectParams);
+    }
+}
+
 bool FProjectAcousticsModule::PostTick()
 {
     if (!m_Triton)
@@ -593,10 +1288,175 @@ bool FProjectAcousticsModule::PostTick()
         return false;
     }
 
-    m_IsOutdoornessStale = true;
+    const int32 frame = FPlatformAtomics::InterlockedIncrement(&m_QueryFrame);
+
+    // Fold the last frame's query timings into the running average the budget is based on
+    const int64 queryCycles = FPlatformAtomics::InterlockedExchange(&m_QueryCycles, 0);
+    const int32 queryCount = FPlatformAtomics::InterlockedExchange(&m_QueryCount, 0);
+    if (queryCount > 0)
+    {
+        const float frameAverage = static_cast<float>(FPlatformTime::ToSeconds64(queryCycles) * 1000000.0 / queryCount);
+        m_AverageQueryMicroseconds = FMath::Lerp(m_AverageQueryMicroseconds, frameAverage, 0.1f);
+        SET_DWORD_STAT(STAT_Acoustics_AverageQueryCost, FMath::RoundToInt(m_AverageQueryMicroseconds));
+    }
+    DispatchPendingQueries(frame);
+
+    // Hand this frame's opening changes to a worker. If the last batch is still being applied, they wait a frame
+    if (!FPlatformAtomics::AtomicRead(&m_OpeningUpdateWork->m_IsQueuedOrRunning))
+    {
+        FScopeLock lock(&m_OpeningLock);
+        if (m_PendingOpeningOps.Num() > 0)
+        {
+            m_OpeningUpdateWork->SignalStart();
+            m_QueryScheduler.AddQueuedWork(0, m_OpeningUpdateWork.Get());
+        }
+    }
+
+    m_QueryScheduler.SetDeadlineSeconds(FMath::Max(c_QueryDeadlineMs, 0.0f) / 1000.0);
+    m_QueryScheduler.BeginFrame();
+
+    // Background streaming finished loading or unloading probes since last frame. Cached results may be stale
+    if (m_TritonTaskHook.IsValid())
+    {
+        const int32 completedLoadTasks = m_TritonTaskHook->GetNumCompletedTasks();
+        if (completedLoadTasks != m_LastCompletedLoadTasks)
+        {
+            m_LastCompletedLoadTasks = completedLoadTasks;
+            OnLoadedRegionChanged();
+        }
+    }
+
+    // Streaming is free again. Issue the newest load that was held back while it was busy
+    if (m_PendingLoad.IsSet() && !IsStreamingBusy())
+    {
+        const FPendingLoad pendingLoad = m_PendingLoad.GetValue();
+        m_PendingLoad.Reset();
+        LoadRegion(pendingLoad.Center, pendingLoad.TileSize, pendingLoad.UnloadOutsideTile, false);
+    }
+    m_QueryCache.Configure(c_QueryCacheEnabled != 0, c_QueryCacheGridSize, c_QueryCacheBudgetKB * 1024);
+    m_QueryCache.UpdateStats();
+    EnforceProbeBudget(frame);
     return true;
 }
 
+bool FProjectAcousticsModule::IsProbeBudgetEnabled() const
+{
+#if ACOUSTICS_TRACK_MEMORY
+    return c_ProbeBudgetMB > 0.0f;
+#else
+    // Nothing could ever be evicted, so streaming must keep unloading tiles itself
+    return false;
+#endif
+}
+
+#if ACOUSTICS_TRACK_MEMORY
+static int64 GetProbeBudgetBytes()
+{
+    return static_cast<int64>(FMath::Max(c_ProbeBudgetMB, 0.0f) * 1024.0f * 1024.0f);
+}
+
+void FProjectAcousticsModule::EvictRegion(const FVector& center, const FVector& size, const int32 frame)
+{
+    m_Triton->UnloadRegion(
+        AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(center)),
+        AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(size).GetAbs()),
+        false);
+    OnLoadedRegionChanged();
+    m_EvictionCompletedTasks = m_TritonTaskHook.IsValid() ? m_TritonTaskHook->GetNumCompletedTasks() : 0;
+    m_EvictionFrame = frame;
+}
+#endif // ACOUSTICS_TRACK_MEMORY
+
+bool FProjectAcousticsModule::MakeRoomForRegion(const int32 frame)
+{
+#if ACOUSTICS_TRACK_MEMORY
+    const int64 budgetBytes = GetProbeBudgetBytes();
+    const int32 numRegions = m_ProbeBudget.GetNumRegions();
+    if (budgetBytes == 0 || numRegions == 0)
+    {
+        return true;
+    }
+
+    // Unloads finish in the background, so rather than wait for memory use to drop, assume the new region costs
+    // as much as the average loaded region, and each evicted region frees that much
+    const int64 bytesUsed = m_TritonMemHook->GetTotalMemoryUsed();
+    const int64 regionBytes = bytesUsed / numRegions;
+    int64 projectedBytes = bytesUsed + regionBytes;
+    FVector center;
+    FVector size;
+    while (projectedBytes > budgetBytes && m_ProbeBudget.PopLeastRecentlyUsed(center, size))
+    {
+        UE_LOG(
+            LogAcousticsRuntime,
+            Verbose,
+            TEXT("Unloading region at %s to make room for a new tile under PA.ProbeBudgetMB"),
+            *center.ToString());
+        EvictRegion(center, size, frame);
+        projectedBytes -= regionBytes;
+    }
+    return projectedBytes <= budgetBytes;
+#else
+    return true;
+#endif // ACOUSTICS_TRACK_MEMORY
+}
+
+void FProjectAcousticsModule::EnforceProbeBudget(const int32 frame)
+{
+#if ACOUSTICS_TRACK_MEMORY
+    const int64 bytesUsed = m_TritonMemHook->GetTotalMemoryUsed();
+    m_ProbeBudget.UpdateStats(bytesUsed);
+
+    const int64 budgetBytes = GetProbeBudgetBytes();
+    if (budgetBytes == 0 || bytesUsed <= budgetBytes || !m_AceFileLoaded)
+    {
+        m_HasWarnedOverBudget = false;
+        return;
+    }
+
+    // Unloads are asynchronous. Give the last one time to free its probes, or we'd evict far more than needed
+    const int32 completedTasks = m_TritonTaskHook.IsValid() ? m_TritonTaskHook->GetNumCompletedTasks() : 0;
+    if (completedTasks == m_EvictionCompletedTasks && frame - m_EvictionFrame < c_ProbeEvictionTimeoutFrames)
+    {
+        return;
+    }
+
+    FVector center;
+    FVector size;
+    if (!m_ProbeBudget.PopLeastRecentlyUsed(center, size))
+    {
+        if (!m_HasWarnedOverBudget)
+        {
+            UE_LOG(
+                LogAcousticsRuntime,
+                Warning,
+                TEXT("Acoustics memory (%.1f MB) is over PA.ProbeBudgetMB (%.1f MB), but no loaded region can be "
+                     "unloaded without unloading the current one"),
+                bytesUsed / (1024.0 * 1024.0),
+                c_ProbeBudgetMB);
+            m_HasWarnedOverBudget = true;
+        }
+        return;
+    }
+
+    UE_LOG(
+        LogAcousticsRuntime,
+        Verbose,
+        TEXT("Acoustics memory (%.1f MB) is over budget, unloading region at %s"),
+        bytesUsed / (1024.0 * 1024.0),
+        *center.ToString());
+    EvictRegion(center, size, frame);
+#else
+    if (c_ProbeBudgetMB > 0.0f && !m_HasWarnedOverBudget)
+    {
+        UE_LOG(
+            LogAcousticsRuntime,
+            Warning,
+            TEXT("PA.ProbeBudgetMB needs Triton memory tracking. Build with ACOUSTICS_TRACK_MEMORY=1 to use it"));
+        m_HasWarnedOverBudget = true;
+    }
+#endif // ACOUSTICS_TRACK_MEMORY
+}
+
 bool FProjectAcousticsModule::UpdateDistances(const FVector& listenerLocation)
 {
     if (!m_Triton)
@@ -621,6 +1481,12 @@ bool FProjectAcousticsModule::QueryDistance(const FVector& lookDirection, float&
     return true;
 }
 
+void FProjectAcousticsModule::TouchLoadedRegions(const FVector& listenerLocation)
+{
+    // Probes are placed along listener paths, so the regions around the listener are the ones being queried
+    m_ProbeBudget.Touch(listenerLocation, FPlatformAtomics::AtomicRead(&m_QueryFrame));
+}
+
 bool FProjectAcousticsModule::UpdateOutdoorness(const FVector& listenerLocation)
 {
     if (!m_Triton)
@@ -628,36 +1494,61 @@ bool FProjectAcousticsModule::UpdateOutdoorness(const FVector& listenerLocation)
         return false;
     }
 
-    // This function will be called by each sound source in a frame.
-    // Since outdoorness depends only on player location, we do work
-    // only once per frame, regardless of whether query succeeds or fails.
-    // In case of failure, we leave the old cached outdoorness value unmodified.
-    if (m_IsOutdoornessStale)
+    // The last computation is still queued or running. Try again next tick rather than stack up requests. Whether
+    // it succeeded decides if another is needed
+    if (FPlatformAtomics::AtomicRead(&m_OutdoornessWork->m_IsQueuedOrRunning))
     {
-        auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
-        bool success = false;
-        {
-            SCOPE_CYCLE_COUNTER(STAT_Acoustics_QueryOutdoorness);
-            auto outdoorness = 0.0f;
-            success = m_Triton->GetOutdoornessAtListener(listener, outdoorness);
-            if (success)
-            {
-                const float NormalizedVal =
-                    (outdoorness - c_OutdoornessIndoors) / (c_OutdoornessOutdoors - c_OutdoornessIndoors);
-                m_CachedOutdoorness = FMath::Clamp(NormalizedVal, 0.0f, 1.0f);
-            }
-        }
+        return true;
+    }
 
-        m_IsOutdoornessStale = false;
-        return success;
+    // Outdoorness depends only on player location and the loaded probes. The listener rarely moves far in a frame,
+    // so only recompute once it has moved past the threshold of the last successful computation, or different
+    // probes have been loaded. In case of failure, the old published value is left unmodified and the computation
+    // is retried.
+    const int32 regionGeneration = FPlatformAtomics::AtomicRead(&m_RegionGeneration);
+    const bool isStale = !m_HasOutdoorness || regionGeneration != m_OutdoornessRegionGeneration ||
+                         FVector::DistSquared(listenerLocation, m_OutdoornessListenerLocation) >
+                             FMath::Square(c_OutdoornessMoveThreshold);
+    if (!isStale)
+    {
+        return true;
     }
 
+    m_OutdoornessRequestLocation = listenerLocation;
+    m_OutdoornessTritonListener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
+    m_OutdoornessRequestGeneration = regionGeneration;
+
+    m_OutdoornessWork->SignalStart();
+    m_QueryScheduler.AddQueuedWork(0, m_OutdoornessWork.Get());
     return true;
 }
 
+void FProjectAcousticsModule::ComputeOutdoorness()
+{
+    SCOPE_CYCLE_COUNTER(STAT_Acoustics_QueryOutdoorness);
+    auto outdoorness = 0.0f;
+    if (m_Triton->GetOutdoornessAtListener(m_OutdoornessTritonListener, outdoorness))
+    {
+        const float NormalizedVal =
+            (outdoorness - c_OutdoornessIndoors) / (c_OutdoornessOutdoors - c_OutdoornessIndoors);
+        m_CachedOutdoorness.store(FMath::Clamp(NormalizedVal, 0.0f, 1.0f), std::memory_order_relaxed);
+
+        // Only now is the published value up to date for these inputs
+        m_OutdoornessListenerLocation = m_OutdoornessRequestLocation;
+        m_OutdoornessRegionGeneration = m_OutdoornessRequestGeneration;
+        m_HasOutdoorness = true;
+    }
+}
+
+void FProjectAcousticsModule::OnLoadedRegionChanged()
+{
+    FPlatformAtomics::InterlockedIncrement(&m_RegionGeneration);
+    m_QueryCache.InvalidateRegion();
+}
+
 inline float FProjectAcousticsModule::GetOutdoorness() const
 {
-    return m_CachedOutdoorness;
+    return m_CachedOutdoorness.load(std::memory_order_relaxed);
 }
 
 bool FProjectAcousticsModule::CalculateReverbSendWeights(
@@ -675,6 +1566,7 @@ bool FProjectAcousticsModule::GetAcousticParameters(
     auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
 
     bool acousticParamsValid = false;
+    const uint64 startCycles = FPlatformTime::Cycles64();
     {
         SCOPE_CYCLE_COUNTER(STAT_Acoustics_Query);
 
@@ -686,6 +1578,10 @@ bool FProjectAcousticsModule::GetAcousticParameters(
 #endif
     }
 
+    // Feeds the per-frame query budget
+    FPlatformAtomics::InterlockedAdd(&m_QueryCycles, static_cast<int64>(FPlatformTime::Cycles64() - startCycles));
+    FPlatformAtomics::InterlockedIncrement(&m_QueryCount);
+
 
     return acousticParamsValid;
 }
@@ -693,10 +1589,7 @@ bool FProjectAcousticsModule::GetAcousticParameters(
 // Wait for any remaining background queries to finish
 void FProjectAcousticsModule::WaitForRunningTasks()
 {
-    while (m_NumRunningTasks > 0)
-    {
-        FPlatformProcess::Sleep(0);
-    }
+    m_NumRunningTasks.Drain(TEXT("WaitForRunningTasks"));
 }
 
 void FProjectAcousticsModule::UpdateLoadedRegion(
@@ -712,23 +1605,75 @@ void FProjectAcousticsModule::UpdateLoadedRegion(
     const auto loadThreshold = m_LastLoadTileSize * c_AceTileLoadMargin * 0.5f;
     bool shouldUpdate = forceUpdate || (difference.X > loadThreshold.X || difference.Y > loadThreshold.Y ||
                                         difference.Z > loadThreshold.Z);
-    if (shouldUpdate)
+    if (!shouldUpdate)
     {
-        int loadedProbes = 0;
-        {
-            SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
-            loadedProbes = m_Triton->LoadRegion(
-                AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(playerPosition)),
-                AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(tileSize).GetAbs()),
-                unloadProbesOutsideTile,
-                blockOnCompletion);
-        }
-        if (loadedProbes >= 0)
-        {
-            m_LastLoadCenterPosition = playerPosition;
-            // Tile Size must be all positive values, otherwise triton fails to load probes
-            m_LastLoadTileSize = tileSize.GetAbs();
-        }
+        return;
+    }
+
+    // Triton streams one task at a time, and can't cancel a load once it has started. Rather than queue up a load
+    // behind it, hold on to the request until streaming is idle. A newer request replaces it, so a listener moving
+    // quickly never waits on tiles it has already left
+    if (!blockOnCompletion && IsStreamingBusy())
+    {
+        m_PendingLoad = FPendingLoad{playerPosition, tileSize, unloadProbesOutsideTile};
+        return;
+    }
+
+    // Anything held back is older than this
+    m_PendingLoad.Reset();
+    LoadRegion(playerPosition, tileSize, unloadProbesOutsideTile, blockOnCompletion);
+}
+
+bool FProjectAcousticsModule::IsStreamingBusy() const
+{
+    return m_TritonTaskHook.IsValid() && m_TritonTaskHook->GetNumRunningTasks() > 0;
+}
+
+void FProjectAcousticsModule::LoadRegion(
+    const FVector& center, const FVector& tileSize, const bool unloadProbesOutsideTile, const bool blockOnCompletion)
+{
+    // Once the player has left the loaded tile, queries around them have no probes until this load finishes.
+    // Jump the loading tasks ahead of other thread pool work
+    if (m_TritonTaskHook.IsValid())
+    {
+        const auto difference = (center - m_LastLoadCenterPosition).GetAbs();
+        const auto halfTileSize = m_LastLoadTileSize * 0.5f;
+        const bool isOutsideLoadedTile =
+            difference.X > halfTileSize.X || difference.Y > halfTileSize.Y || difference.Z > halfTileSize.Z;
+        m_TritonTaskHook->SetLaunchPriority(
+            isOutsideLoadedTile || blockOnCompletion ? EQueuedWorkPriority::High : EQueuedWorkPriority::Normal);
+    }
+
+    // Keeping the tiles already loaded mustn't take probe memory over budget. Evict before loading, so the
+    // budget is never exceeded by waiting for the load to show up in memory use. If nothing more can be
+    // evicted, load the tile on its own, as streaming does without a budget
+    const int32 frame = FPlatformAtomics::AtomicRead(&m_QueryFrame);
+    bool unloadOutsideTile = unloadProbesOutsideTile;
+    if (!unloadOutsideTile && !MakeRoomForRegion(frame))
+    {
+        UE_LOG(
+            LogAcousticsRuntime,
+            Verbose,
+            TEXT("No room under PA.ProbeBudgetMB for another tile. Unloading everything outside the new one"));
+        unloadOutsideTile = true;
+    }
+
+    int loadedProbes = 0;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
+        loadedProbes = m_Triton->LoadRegion(
+            AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(center)),
+            AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(tileSize).GetAbs()),
+            unloadOutsideTile,
+            blockOnCompletion);
+    }
+    if (loadedProbes >= 0)
+    {
+        OnLoadedRegionChanged();
+        m_ProbeBudget.OnRegionLoaded(center, tileSize, unloadOutsideTile, frame);
+        m_LastLoadCenterPosition = center;
+        // Tile Size must be all positive values, otherwise triton fails to load probes
+        m_LastLoadTileSize = tileSize.GetAbs();
     }
 }
 
@@ -0,0 +1,112 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "AcousticsProbeBudget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsProbeBudgetEvictionTest, "ProjectAcoustics.ProbeBudget.Eviction",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsProbeBudgetEvictionTest::RunTest(const FString& Parameters)
+{
+    // Four regions side by side along X, far enough apart not to overlap
+    const FVector size(1000.0f, 1000.0f, 1000.0f);
+    const FVector centers[] = {
+        FVector(0.0f, 0.0f, 0.0f), FVector(2000.0f, 0.0f, 0.0f), FVector(4000.0f, 0.0f, 0.0f),
+        FVector(6000.0f, 0.0f, 0.0f)};
+
+    FAcousticsProbeBudget budget;
+    FVector center;
+    FVector evictedSize;
+    TestFalse(TEXT("Nothing to evict without regions"), budget.PopLeastRecentlyUsed(center, evictedSize));
+
+    for (int32 i = 0; i < 4; i++)
+    {
+        budget.OnRegionLoaded(centers[i], size, false, i + 1);
+    }
+    TestEqual(TEXT("Regions loaded"), budget.GetNumRegions(), 4);
+
+    // Reloading a region moves it to the back instead of adding it again
+    budget.OnRegionLoaded(centers[3], size, false, 4);
+    TestEqual(TEXT("Reloaded region isn't duplicated"), budget.GetNumRegions(), 4);
+
+    // The listener passes back through the second region, then the first, and is now in the newest
+    budget.Touch(centers[1], 10);
+    budget.Touch(centers[0], 11);
+    budget.Touch(centers[3], 12);
+
+    // Least recently used first: the third region was never visited, then the second, then the first
+    TestTrue(TEXT("Evict the unvisited region"), budget.PopLeastRecentlyUsed(center, evictedSize));
+    TestEqual(TEXT("Unvisited region"), center, centers[2]);
+    TestEqual(TEXT("Evicted region's size"), evictedSize, size);
+    TestTrue(TEXT("Evict the region left longest ago"), budget.PopLeastRecentlyUsed(center, evictedSize));
+    TestEqual(TEXT("Region left longest ago"), center, centers[1]);
+    TestTrue(TEXT("Evict the region left most recently"), budget.PopLeastRecentlyUsed(center, evictedSize));
+    TestEqual(TEXT("Region left most recently"), center, centers[0]);
+    TestFalse(TEXT("The listener's region is never evicted"), budget.PopLeastRecentlyUsed(center, evictedSize));
+    TestEqual(TEXT("Regions left"), budget.GetNumRegions(), 1);
+
+    // Loading with everything outside unloaded replaces every region
+    budget.OnRegionLoaded(centers[0], size, false, 13);
+    budget.OnRegionLoaded(centers[1], size, true, 14);
+    TestEqual(TEXT("Unloading outside replaces every region"), budget.GetNumRegions(), 1);
+
+    budget.Reset();
+    TestEqual(TEXT("Reset forgets every region"), budget.GetNumRegions(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsProbeBudgetInUseTest, "ProjectAcoustics.ProbeBudget.InUse",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsProbeBudgetInUseTest::RunTest(const FString& Parameters)
+{
+    const FVector size(1000.0f, 1000.0f, 1000.0f);
+    FVector center;
+    FVector evictedSize;
+
+    // The newest region is still being streamed in around the listener, even if it hasn't been touched yet
+    {
+        FAcousticsProbeBudget budget;
+        budget.OnRegionLoaded(FVector(0.0f, 0.0f, 0.0f), size, false, 1);
+        budget.OnRegionLoaded(FVector(2000.0f, 0.0f, 0.0f), size, false, 2);
+        budget.Touch(FVector(0.0f, 0.0f, 0.0f), 3);
+        TestFalse(TEXT("Neither the newest nor the listener's region is evicted"),
+            budget.PopLeastRecentlyUsed(center, evictedSize));
+    }
+
+    // Unloading is by box, so a region overlapping one in use would take some of its probes with it
+    {
+        FAcousticsProbeBudget budget;
+        budget.OnRegionLoaded(FVector(0.0f, 0.0f, 0.0f), size, false, 1);
+        budget.OnRegionLoaded(FVector(500.0f, 0.0f, 0.0f), size, false, 2);
+        budget.OnRegionLoaded(FVector(5000.0f, 0.0f, 0.0f), size, false, 3);
+        budget.Touch(FVector(700.0f, 0.0f, 0.0f), 4);
+        TestFalse(TEXT("A region overlapping the listener's is never evicted"),
+            budget.PopLeastRecentlyUsed(center, evictedSize));
+
+        // Once the listener moves on to the newest region, the overlapping pair can go
+        budget.Touch(FVector(5000.0f, 0.0f, 0.0f), 5);
+        TestTrue(TEXT("Evict once the listener has left"), budget.PopLeastRecentlyUsed(center, evictedSize));
+        TestEqual(TEXT("Oldest region first"), center, FVector(0.0f, 0.0f, 0.0f));
+    }
+
+    // Every region the listener is inside counts as in use, not just one
+    {
+        FAcousticsProbeBudget budget;
+        budget.OnRegionLoaded(FVector(0.0f, 0.0f, 0.0f), size, false, 1);
+        budget.OnRegionLoaded(FVector(3000.0f, 0.0f, 0.0f), size, false, 2);
+        budget.OnRegionLoaded(FVector(0.0f, 0.0f, 0.0f), size * 2.0f, false, 3);
+        budget.Touch(FVector(100.0f, 0.0f, 0.0f), 4);
+        TestTrue(TEXT("Evict the region the listener isn't in"), budget.PopLeastRecentlyUsed(center, evictedSize));
+        TestEqual(TEXT("Region the listener isn't in"), center, FVector(3000.0f, 0.0f, 0.0f));
+        TestFalse(TEXT("Both regions around the listener are kept"), budget.PopLeastRecentlyUsed(center, evictedSize));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,126 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "AcousticsQueryCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    const TritonRuntime::InterpolationConfig c_QueryCacheTestConfig;
+
+    // Looks up a query, and stores results tagged with value if it missed. Returns whether it hit, and the value
+    bool FindOrAddInQueryCache(
+        FAcousticsQueryCache& cache, const FVector& source, const FVector& listener, const bool applyOpenings,
+        const float value, float& outValue)
+    {
+        TritonAcousticParameters params = {};
+        TritonDynamicOpeningInfo openingInfo = {};
+        FAcousticsQueryCache::FKey key;
+        if (cache.Find(source, listener, c_QueryCacheTestConfig, applyOpenings, params, openingInfo, key))
+        {
+            outValue = params.Dry.LoudnessDb;
+            return true;
+        }
+        params.Dry.LoudnessDb = value;
+        cache.Add(key, params, openingInfo);
+        outValue = value;
+        return false;
+    }
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsQueryCacheLookupTest, "ProjectAcoustics.QueryCache.Lookup",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsQueryCacheLookupTest::RunTest(const FString& Parameters)
+{
+    FAcousticsQueryCache cache;
+    const FVector source(150.0f, 250.0f, 50.0f);
+    const FVector listener(-450.0f, 20.0f, 120.0f);
+    float value = 0.0f;
+    auto findOrAdd = [&cache, &listener, &value](const FVector& at, const bool applyOpenings, const float newValue)
+    { return FindOrAddInQueryCache(cache, at, listener, applyOpenings, newValue, value); };
+
+    TestFalse(TEXT("Disabled by default"), cache.IsEnabled());
+    findOrAdd(source, false, 1.0f);
+    TestFalse(TEXT("A disabled cache stores nothing"), findOrAdd(source, false, 2.0f));
+
+    cache.Configure(true, 100.0f, 1024 * 1024);
+    TestTrue(TEXT("Enabled"), cache.IsEnabled());
+    TestFalse(TEXT("First lookup misses"), findOrAdd(source, false, 1.0f));
+    TestTrue(TEXT("Same query hits"), findOrAdd(source, false, 2.0f));
+    TestEqual(TEXT("Hit returns the stored results"), value, 1.0f);
+
+    TestTrue(TEXT("Anywhere in the same grid cell hits"), findOrAdd(FVector(199.0f, 200.0f, 0.0f), false, 2.0f));
+    TestFalse(TEXT("The next grid cell misses"), findOrAdd(FVector(201.0f, 250.0f, 50.0f), false, 2.0f));
+    TestFalse(TEXT("Applying openings is a different query"), findOrAdd(source, true, 3.0f));
+
+    // Openings only affect sources that apply them
+    cache.InvalidateOpenings();
+    TestTrue(TEXT("Opening change keeps sources that ignore openings"), findOrAdd(source, false, 4.0f));
+    TestFalse(TEXT("Opening change drops sources that apply openings"), findOrAdd(source, true, 4.0f));
+
+    // Loading or unloading probes drops everything
+    cache.InvalidateRegion();
+    TestFalse(TEXT("Region change drops every entry"), findOrAdd(source, false, 5.0f));
+    TestTrue(TEXT("Results for the new region are cached"), findOrAdd(source, false, 6.0f));
+    TestEqual(TEXT("New region's results"), value, 5.0f);
+
+    // A query whose region changed while it ran is stored under its stale key, and never hit
+    TritonAcousticParameters params = {};
+    TritonDynamicOpeningInfo openingInfo = {};
+    FAcousticsQueryCache::FKey key;
+    const FVector otherSource(-1000.0f, -1000.0f, 0.0f);
+    TestFalse(
+        TEXT("Miss before a slow query"),
+        cache.Find(otherSource, listener, c_QueryCacheTestConfig, false, params, openingInfo, key));
+    cache.InvalidateRegion();
+    cache.Add(key, params, openingInfo);
+    TestFalse(TEXT("Results from before a region change are never hit"), findOrAdd(otherSource, false, 7.0f));
+
+    // Changing the grid empties the cache
+    cache.Configure(true, 50.0f, 1024 * 1024);
+    TestFalse(TEXT("Reconfigured cache is empty"), findOrAdd(source, false, 8.0f));
+
+    cache.Configure(false, 50.0f, 1024 * 1024);
+    TestFalse(TEXT("Disabled again"), cache.IsEnabled());
+    TestFalse(TEXT("A disabled cache never hits"), findOrAdd(source, false, 9.0f));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsQueryCacheEvictionTest, "ProjectAcoustics.QueryCache.Eviction",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsQueryCacheEvictionTest::RunTest(const FString& Parameters)
+{
+    // Room for a few hundred entries, far fewer than are added
+    FAcousticsQueryCache cache;
+    cache.Configure(true, 100.0f, 64 * 1024);
+    float value = 0.0f;
+    auto findOrAdd = [&cache, &value](const FVector& at, const float newValue)
+    { return FindOrAddInQueryCache(cache, at, FVector::ZeroVector, false, newValue, value); };
+
+    const FVector kept(-500.0f, 0.0f, 0.0f);
+    findOrAdd(kept, -1.0f);
+    constexpr int32 numEntries = 10000;
+    for (int32 i = 0; i < numEntries; i++)
+    {
+        findOrAdd(FVector(i * 100.0f, 0.0f, 0.0f), static_cast<float>(i));
+        // Looking this one up keeps it at the front of the LRU list
+        if (!findOrAdd(kept, -2.0f))
+        {
+            AddError(FString::Printf(TEXT("Recently used entry was evicted after %d other entries"), i + 1));
+            return false;
+        }
+    }
+
+    TestFalse(TEXT("Least recently used entry was evicted"), findOrAdd(FVector::ZeroVector, 0.0f));
+    TestTrue(TEXT("Most recent entry is kept"), findOrAdd(FVector((numEntries - 1) * 100.0f, 0.0f, 0.0f), 0.0f));
+    TestEqual(TEXT("Most recent entry's results"), value, static_cast<float>(numEntries - 1));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,123 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "AcousticsResultSlot.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Results whose fields all carry the same value, so a torn copy shows up as a mismatch
+    void MakeSlotTestResults(const float value, AcousticQueryResults& outResults)
+    {
+        outResults.AcousticParams.Dry.LoudnessDb = value;
+        outResults.AcousticParams.Wet.LoudnessDb = value;
+        outResults.AcousticParams.Wet.DecayTimeSeconds = value;
+        outResults.QueryResult = true;
+    }
+
+    bool IsSlotTestResultConsistent(const AcousticQueryResults& results)
+    {
+        return results.AcousticParams.Dry.LoudnessDb == results.AcousticParams.Wet.LoudnessDb &&
+               results.AcousticParams.Dry.LoudnessDb == results.AcousticParams.Wet.DecayTimeSeconds;
+    }
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsResultSlotPublishTest, "ProjectAcoustics.ResultSlot.PublishAndTake",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsResultSlotPublishTest::RunTest(const FString& Parameters)
+{
+    // Slots only use the module and counter to run queries, which this test doesn't do
+    FAcousticsResultSlot slot(nullptr, nullptr);
+    AcousticQueryResults results;
+    AcousticQueryResults taken;
+
+    TestFalse(TEXT("Nothing to take from a new slot"), slot.Take(taken));
+
+    slot.Reset();
+    const int32 generation = slot.Generation;
+    MakeSlotTestResults(1.0f, results);
+    TestTrue(TEXT("Publish for the current generation"), slot.Publish(results, generation));
+    TestTrue(TEXT("Take new results"), slot.Take(taken));
+    TestEqual(TEXT("Taken results"), taken.AcousticParams.Dry.LoudnessDb, 1.0f);
+    TestFalse(TEXT("Results are only taken once"), slot.Take(taken));
+    TestTrue(TEXT("Latest results can be read again"), slot.TakeLatest(taken));
+
+    MakeSlotTestResults(2.0f, results);
+    TestTrue(TEXT("Publish again"), slot.Publish(results, generation));
+    TestTrue(TEXT("Take newer results"), slot.Take(taken));
+    TestEqual(TEXT("Newer results"), taken.AcousticParams.Dry.LoudnessDb, 2.0f);
+
+    // A query that started before the source re-registered must not land
+    slot.Reset();
+    MakeSlotTestResults(3.0f, results);
+    TestFalse(TEXT("Publish for an old generation is dropped"), slot.Publish(results, generation));
+    TestFalse(TEXT("Nothing new after a dropped publish"), slot.Take(taken));
+    TestFalse(TEXT("Results from before the reset aren't latest"), slot.TakeLatest(taken));
+
+    // Only one writer may publish at a time
+    const int32 sequence = slot.Sequence;
+    slot.Sequence = sequence + 1;
+    TestFalse(TEXT("Publish while another writer holds the slot"), slot.Publish(results, slot.Generation));
+    TestFalse(TEXT("Read gives up while a writer holds the slot"), slot.TakeLatest(taken));
+    slot.Sequence = sequence;
+
+    TestTrue(TEXT("Publish for the new generation"), slot.Publish(results, slot.Generation));
+    TestTrue(TEXT("Take results for the new generation"), slot.Take(taken));
+    TestEqual(TEXT("New generation's results"), taken.AcousticParams.Dry.LoudnessDb, 3.0f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsResultSlotConcurrentTest, "ProjectAcoustics.ResultSlot.Concurrent",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsResultSlotConcurrentTest::RunTest(const FString& Parameters)
+{
+    FAcousticsResultSlot slot(nullptr, nullptr);
+    const int32 generation = slot.Generation;
+    constexpr int32 numPublishes = 100000;
+
+    TFuture<void> writer = Async(
+        EAsyncExecution::Thread,
+        [&slot, generation]()
+        {
+            AcousticQueryResults results;
+            for (int32 i = 1; i <= numPublishes; i++)
+            {
+                MakeSlotTestResults(static_cast<float>(i), results);
+                slot.Publish(results, generation);
+            }
+        });
+
+    // Every read that succeeds must be whole, and never go back in time
+    AcousticQueryResults taken;
+    float lastTaken = 0.0f;
+    int32 numTaken = 0;
+    int32 numTorn = 0;
+    int32 numBackwards = 0;
+    while (!writer.IsReady())
+    {
+        if (slot.Take(taken))
+        {
+            numTaken++;
+            numTorn += IsSlotTestResultConsistent(taken) ? 0 : 1;
+            numBackwards += taken.AcousticParams.Dry.LoudnessDb < lastTaken ? 1 : 0;
+            lastTaken = taken.AcousticParams.Dry.LoudnessDb;
+        }
+    }
+    writer.Wait();
+
+    AddInfo(FString::Printf(TEXT("Took %d of %d results"), numTaken, numPublishes));
+    TestEqual(TEXT("Torn reads"), numTorn, 0);
+    TestEqual(TEXT("Reads older than the one before"), numBackwards, 0);
+    TestTrue(TEXT("Latest results after the writer finishes"), slot.TakeLatest(taken));
+    TestEqual(TEXT("Last published results"), taken.AcousticParams.Dry.LoudnessDb, static_cast<float>(numPublishes));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,115 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "MathUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace AcousticsUtils;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsFastExp2Test, "ProjectAcoustics.MathUtils.FastExp2",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsFastExp2Test::RunTest(const FString& Parameters)
+{
+    double maxError = 0.0;
+    constexpr int32 numSteps = 200000;
+    for (int32 i = 0; i <= numSteps; i++)
+    {
+        const float x = -100.0f + 200.0f * i / numSteps;
+        maxError = FMath::Max(maxError, FMath::Abs(FastExp2(x) / FMath::Pow(2.0, static_cast<double>(x)) - 1.0));
+    }
+    AddInfo(FString::Printf(TEXT("Max relative error %g"), maxError));
+    TestTrue(TEXT("Relative error is under 1.1e-4"), maxError < 1.1e-4);
+
+    for (int32 power = -126; power <= 126; power++)
+    {
+        if (FastExp2(static_cast<float>(power)) != static_cast<float>(FMath::Pow(2.0, static_cast<double>(power))))
+        {
+            AddError(FString::Printf(TEXT("2^%d isn't exact"), power));
+        }
+    }
+
+    TestEqual(TEXT("Clamped below"), FastExp2(-1000.0f), FastExp2(-126.0f));
+    TestEqual(TEXT("Clamped above"), FastExp2(1000.0f), FastExp2(126.0f));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsFastLog2Test, "ProjectAcoustics.MathUtils.FastLog2",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsFastLog2Test::RunTest(const FString& Parameters)
+{
+    double maxError = 0.0;
+    constexpr int32 numSteps = 200000;
+    for (int32 i = 0; i <= numSteps; i++)
+    {
+        const float x = static_cast<float>(FMath::Pow(2.0, -100.0 + 200.0 * i / numSteps));
+        maxError = FMath::Max(maxError, FMath::Abs(FastLog2(x) - FMath::LogX(2.0, static_cast<double>(x))));
+    }
+    AddInfo(FString::Printf(TEXT("Max absolute error %g"), maxError));
+    TestTrue(TEXT("Absolute error is under 1.5e-4"), maxError < 1.5e-4);
+
+    for (int32 power = -126; power <= 127; power++)
+    {
+        if (FastLog2(static_cast<float>(FMath::Pow(2.0, static_cast<double>(power)))) != static_cast<float>(power))
+        {
+            AddError(FString::Printf(TEXT("log2(2^%d) isn't exact"), power));
+        }
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsFastDbConversionTest, "ProjectAcoustics.MathUtils.FastDbConversion",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsFastDbConversionTest::RunTest(const FString& Parameters)
+{
+    double maxToAmplitudeError = 0.0;
+    double maxToDbError = 0.0;
+    constexpr int32 numSteps = 144000;
+    TArray<float> decibels;
+    decibels.SetNumUninitialized(numSteps + 1);
+    for (int32 i = 0; i <= numSteps; i++)
+    {
+        const float db = -120.0f + 144.0f * i / numSteps;
+        decibels[i] = db;
+
+        // Error in dB of the fast amplitude
+        const double exactAmplitude = FMath::Pow(10.0, db / 20.0);
+        const double amplitudeError = 20.0 * FMath::LogX(10.0, DbToAmplitudeFast(db) / exactAmplitude);
+        maxToAmplitudeError = FMath::Max(maxToAmplitudeError, FMath::Abs(amplitudeError));
+
+        const float amplitude = static_cast<float>(exactAmplitude);
+        const double dbError = AmplitudeToDbFast(amplitude) - AmplitudeToDbExact(amplitude);
+        maxToDbError = FMath::Max(maxToDbError, FMath::Abs(dbError));
+    }
+    AddInfo(FString::Printf(TEXT("Max error %g dB to amplitude, %g dB to dB"), maxToAmplitudeError, maxToDbError));
+    TestTrue(TEXT("DbToAmplitudeFast is within 0.001 dB"), maxToAmplitudeError < 0.001);
+    TestTrue(TEXT("AmplitudeToDbFast is within 0.001 dB"), maxToDbError < 0.001);
+
+    // Silence is clamped rather than turned into -inf
+    TestTrue(TEXT("Zero amplitude is finite"), FMath::IsFinite(AmplitudeToDbFast(0.0f)));
+
+    // The array versions give the same results as the scalar ones, in place too
+    TArray<float> amplitudes;
+    amplitudes.SetNumUninitialized(decibels.Num());
+    DbToAmplitude(decibels, amplitudes);
+    TArray<float> roundTrip = amplitudes;
+    AmplitudeToDb(roundTrip, roundTrip);
+    for (int32 i = 0; i < decibels.Num(); i++)
+    {
+        if (amplitudes[i] != DbToAmplitude(decibels[i]) || roundTrip[i] != AmplitudeToDb(amplitudes[i]))
+        {
+            AddError(FString::Printf(TEXT("Array conversion differs from scalar at %f dB"), decibels[i]));
+            break;
+        }
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -6,9 +6,13 @@
 #include "Async/Async.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_STAT(STAT_Acoustics_Memory);
+DEFINE_STAT(STAT_Acoustics_PooledSlabMemory);
 DEFINE_STAT(STAT_Acoustics_FileReads);
+DEFINE_STAT(STAT_Acoustics_ReadAheadHits);
+DEFINE_STAT(STAT_Acoustics_FileReadStallMs);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// LOG HOOK
@@ -65,26 +69,35 @@ namespace TritonRuntime
     {
         void* outPtr = FMemory::Malloc(inSize, 16);
 
-#if !UE_BUILD_SHIPPING
+#if ACOUSTICS_MEMORY_TRACING
+        FAcousticsMemoryTrace::RecordAlloc(outPtr, inSize, 16);
+#endif
+
+#if ACOUSTICS_TRACK_MEMORY
         // Allocated block size can be larger than requested, get the actual size.
         // (Note that this deals with nullptr correctly)
         auto allocSize = FMemory::GetAllocSize(outPtr);
         INC_MEMORY_STAT_BY(STAT_Acoustics_Memory, allocSize);
         FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, static_cast<int64>(allocSize));
-#endif //! UE_BUILD_SHIPPING
+#endif // ACOUSTICS_TRACK_MEMORY
 
         return outPtr;
     }
 
     void* FTritonMemHook::Realloc(void* inPtr, size_t size)
     {
-#if !UE_BUILD_SHIPPING
+#if ACOUSTICS_TRACK_MEMORY
         int64 oldSize = FMemory::GetAllocSize(inPtr);
 #endif
 
         void* outPtr = FMemory::Realloc(inPtr, size, 16);
 
-#if !UE_BUILD_SHIPPING
+#if ACOUSTICS_MEMORY_TRACING
+        FAcousticsMemoryTrace::RecordFree(inPtr);
+        FAcousticsMemoryTrace::RecordAlloc(outPtr, size, 16);
+#endif
+
+#if ACOUSTICS_TRACK_MEMORY
         int64 newSize = FMemory::GetAllocSize(outPtr);
 
         // Increment counters if new size is larger, decrement otherwise
@@ -98,19 +111,23 @@ namespace TritonRuntime
             DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, oldSize - newSize);
             FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(oldSize - newSize));
         }
-#endif //! UE_BUILD_SHIPPING
+#endif // ACOUSTICS_TRACK_MEMORY
 
         return outPtr;
     }
 
     void FTritonMemHook::Free(void* inPtr)
     {
-#if !UE_BUILD_SHIPPING
+#if ACOUSTICS_MEMORY_TRACING
+        FAcousticsMemoryTrace::RecordFree(inPtr);
+#endif
+
+#if ACOUSTICS_TRACK_MEMORY
         // note that this deals will nullptr correctly
         auto AllocSize = FMemory::GetAllocSize(inPtr);
         DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, AllocSize);
         FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(AllocSize));
-#endif //! UE_BUILD_SHIPPING
+#endif // ACOUSTICS_TRACK_MEMORY
 
         FMemory::Free(inPtr);
     }
@@ -124,34 +141,362 @@ namespace TritonRuntime
         return m_TotalMemoryUsed;
     }
 
+#if ACOUSTICS_MEMORY_TRACING
+    void FTritonMemHook::StartAllocationScope(const wchar_t* scopeName)
+    {
+        FAcousticsMemoryTrace::PushScope(scopeName);
+    }
+
+    void FTritonMemHook::StopAllocationScope(const wchar_t* scopeName)
+    {
+        FAcousticsMemoryTrace::PopScope();
+    }
+#endif // ACOUSTICS_MEMORY_TRACING
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// POOLED MEM HOOK
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Block sizes, not counting the header. Roughly 1.5x apart, so at most a third of a block is wasted
+    static const uint32 c_SizeClassSizes[FTritonPooledMemHook::c_NumSizeClasses] = {
+        16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096};
+    constexpr size_t c_MaxPooledSize = 4096;
+    constexpr size_t c_PoolSlabSize = 64 * 1024;
+    // Blocks a thread keeps for itself per size class, and how many move to or from the central list at once
+    constexpr int32 c_MaxThreadCachedBlocks = 64;
+    constexpr int32 c_PoolTransferBlocks = 32;
+    // Size class recorded in the header of allocations that bypass the pools
+    constexpr uint32 c_UnpooledSizeClass = MAX_uint32;
+
+    // Sits in front of every block handed to Triton. 16 bytes, so the memory after it stays 16 byte aligned
+    struct alignas(16) FPoolBlockHeader
+    {
+        uint32 SizeClass;
+        uint32 Padding;
+        uint64 Size;
+    };
+    static_assert(sizeof(FPoolBlockHeader) == 16, "Pool block header must keep allocations 16 byte aligned");
+
+    struct FTritonPooledMemHook::FThreadCache
+    {
+        uint32 OwnerId = 0;
+        FFreeBlock* FreeLists[c_NumSizeClasses] = {};
+        int32 NumFree[c_NumSizeClasses] = {};
+    };
+
+    static volatile int32 s_NextPooledHookId = 0;
+    static FTritonPooledMemHook* s_ActivePooledHook = nullptr;
+
+    static FAutoConsoleCommand CmdAcousticsMemPoolReport(
+        TEXT("PA.MemPoolReport"),
+        TEXT("Logs how much of Triton's pooled memory is in use, per size class"),
+        FConsoleCommandDelegate::CreateLambda(
+            []()
+            {
+                if (s_ActivePooledHook != nullptr)
+                {
+                    s_ActivePooledHook->LogUsageReport();
+                }
+                else
+                {
+                    UE_LOG(LogAcousticsRuntime, Display, TEXT("Triton memory isn't pooled. See PA.PooledMemory"));
+                }
+            }));
+
+    FTritonPooledMemHook::FTritonPooledMemHook()
+        : m_Id(static_cast<uint32>(FPlatformAtomics::InterlockedIncrement(&s_NextPooledHookId))), m_SlabBytes(0)
+    {
+        int32 sizeClass = 0;
+        for (int32 step = 0; step <= static_cast<int32>(c_MaxPooledSize / 16); step++)
+        {
+            while (c_SizeClassSizes[sizeClass] < static_cast<uint32>(step * 16))
+            {
+                sizeClass++;
+            }
+            m_SizeClassLookup[step] = static_cast<uint8>(sizeClass);
+        }
+        s_ActivePooledHook = this;
+    }
+
+    FTritonPooledMemHook::~FTritonPooledMemHook()
+    {
+        if (s_ActivePooledHook == this)
+        {
+            s_ActivePooledHook = nullptr;
+        }
+        for (FSizeClass& sizeClass : m_SizeClasses)
+        {
+            for (void* slab : sizeClass.Slabs)
+            {
+                FMemory::Free(slab);
+            }
+        }
+        SET_MEMORY_STAT(STAT_Acoustics_PooledSlabMemory, 0);
+    }
+
+    FTritonPooledMemHook::FThreadCache& FTritonPooledMemHook::GetThreadCache()
+    {
+        // Blocks cached by a thread that exits stay in their slabs unused until the hook is destroyed. Triton only
+        // allocates from the game thread and the thread pool, which live as long as the hook
+        static thread_local FThreadCache t_PoolThreadCache;
+        FThreadCache& cache = t_PoolThreadCache;
+        if (cache.OwnerId != m_Id)
+        {
+            // Left over from an earlier hook, whose slabs are gone
+            cache = FThreadCache();
+            cache.OwnerId = m_Id;
+        }
+        return cache;
+    }
+
+    bool FTritonPooledMemHook::Refill(int32 sizeClass, FThreadCache& cache)
+    {
+        FSizeClass& pool = m_SizeClasses[sizeClass];
+        FScopeLock lock(&pool.Lock);
+
+        if (pool.FreeList == nullptr)
+        {
+            // Carve a new slab into blocks
+            const size_t blockSize = sizeof(FPoolBlockHeader) + c_SizeClassSizes[sizeClass];
+            const int32 numBlocks = static_cast<int32>(c_PoolSlabSize / blockSize);
+            uint8* slab = static_cast<uint8*>(FMemory::Malloc(c_PoolSlabSize, 16));
+            if (slab == nullptr)
+            {
+                return false;
+            }
+            pool.Slabs.Add(slab);
+            pool.NumBlocks += numBlocks;
+            for (int32 i = numBlocks - 1; i >= 0; i--)
+            {
+                FFreeBlock* block = reinterpret_cast<FFreeBlock*>(slab + i * blockSize);
+                block->Next = pool.FreeList;
+                pool.FreeList = block;
+            }
+            FPlatformAtomics::InterlockedAdd(&m_SlabBytes, static_cast<int64>(c_PoolSlabSize));
+            INC_MEMORY_STAT_BY(STAT_Acoustics_PooledSlabMemory, c_PoolSlabSize);
+        }
+
+        for (int32 i = 0; i < c_PoolTransferBlocks && pool.FreeList != nullptr; i++)
+        {
+            FFreeBlock* block = pool.FreeList;
+            pool.FreeList = block->Next;
+            block->Next = cache.FreeLists[sizeClass];
+            cache.FreeLists[sizeClass] = block;
+            cache.NumFree[sizeClass]++;
+        }
+        return true;
+    }
+
+    void FTritonPooledMemHook::Flush(int32 sizeClass, FThreadCache& cache, int32 numToKeep)
+    {
+        FSizeClass& pool = m_SizeClasses[sizeClass];
+        FScopeLock lock(&pool.Lock);
+        while (cache.NumFree[sizeClass] > numToKeep)
+        {
+            FFreeBlock* block = cache.FreeLists[sizeClass];
+            cache.FreeLists[sizeClass] = block->Next;
+            cache.NumFree[sizeClass]--;
+            block->Next = pool.FreeList;
+            pool.FreeList = block;
+        }
+    }
+
+    void* FTritonPooledMemHook::Malloc(size_t inSize)
+    {
+        FPoolBlockHeader* header = nullptr;
+        size_t blockSize = 0;
+        if (inSize > c_MaxPooledSize)
+        {
+            blockSize = sizeof(FPoolBlockHeader) + inSize;
+            header = static_cast<FPoolBlockHeader*>(FMemory::Malloc(blockSize, 16));
+            if (header == nullptr)
+            {
+                return nullptr;
+            }
+            header->SizeClass = c_UnpooledSizeClass;
+        }
+        else
+        {
+            const int32 sizeClass = m_SizeClassLookup[(inSize + 15) / 16];
+            FThreadCache& cache = GetThreadCache();
+            if (cache.FreeLists[sizeClass] == nullptr && !Refill(sizeClass, cache))
+            {
+                return nullptr;
+            }
+            FFreeBlock* block = cache.FreeLists[sizeClass];
+            cache.FreeLists[sizeClass] = block->Next;
+            cache.NumFree[sizeClass]--;
+            FPlatformAtomics::InterlockedIncrement(&m_SizeClasses[sizeClass].NumLiveBlocks);
+
+            blockSize = sizeof(FPoolBlockHeader) + c_SizeClassSizes[sizeClass];
+            header = reinterpret_cast<FPoolBlockHeader*>(block);
+            header->SizeClass = static_cast<uint32>(sizeClass);
+        }
+        header->Size = inSize;
+
+#if ACOUSTICS_MEMORY_TRACING
+        FAcousticsMemoryTrace::RecordAlloc(header + 1, inSize, 16);
+#endif
+
+#if ACOUSTICS_TRACK_MEMORY
+        INC_MEMORY_STAT_BY(STAT_Acoustics_Memory, blockSize);
+        FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, static_cast<int64>(blockSize));
+#endif // ACOUSTICS_TRACK_MEMORY
+
+        return header + 1;
+    }
+
+    size_t FTritonPooledMemHook::GetUsableSize(void* inPtr)
+    {
+        const FPoolBlockHeader* header = static_cast<FPoolBlockHeader*>(inPtr) - 1;
+        return header->SizeClass == c_UnpooledSizeClass ? header->Size : c_SizeClassSizes[header->SizeClass];
+    }
+
+    void* FTritonPooledMemHook::Realloc(void* inPtr, size_t size)
+    {
+        if (inPtr == nullptr)
+        {
+            return Malloc(size);
+        }
+        if (size == 0)
+        {
+            Free(inPtr);
+            return nullptr;
+        }
+
+        // Still fits, and wouldn't fit a smaller class
+        const size_t usableSize = GetUsableSize(inPtr);
+        FPoolBlockHeader* header = static_cast<FPoolBlockHeader*>(inPtr) - 1;
+        if (header->SizeClass != c_UnpooledSizeClass && size <= usableSize &&
+            m_SizeClassLookup[(size + 15) / 16] == header->SizeClass)
+        {
+            header->Size = size;
+#if ACOUSTICS_MEMORY_TRACING
+            FAcousticsMemoryTrace::RecordFree(inPtr);
+            FAcousticsMemoryTrace::RecordAlloc(inPtr, size, 16);
+#endif
+            return inPtr;
+        }
+
+        void* outPtr = Malloc(size);
+        if (outPtr != nullptr)
+        {
+            FMemory::Memcpy(outPtr, inPtr, FMath::Min(static_cast<size_t>(header->Size), size));
+            Free(inPtr);
+        }
+        return outPtr;
+    }
+
+    void FTritonPooledMemHook::Free(void* inPtr)
+    {
+        if (inPtr == nullptr)
+        {
+            return;
+        }
+
+#if ACOUSTICS_MEMORY_TRACING
+        FAcousticsMemoryTrace::RecordFree(inPtr);
+#endif
+
+        FPoolBlockHeader* header = static_cast<FPoolBlockHeader*>(inPtr) - 1;
+        const uint32 sizeClass = header->SizeClass;
+#if ACOUSTICS_TRACK_MEMORY
+        const size_t blockSize = sizeof(FPoolBlockHeader) + GetUsableSize(inPtr);
+        DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, blockSize);
+        FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(blockSize));
+#endif // ACOUSTICS_TRACK_MEMORY
+
+        if (sizeClass == c_UnpooledSizeClass)
+        {
+            FMemory::Free(header);
+            return;
+        }
+
+        FPlatformAtomics::InterlockedDecrement(&m_SizeClasses[sizeClass].NumLiveBlocks);
+        FThreadCache& cache = GetThreadCache();
+        FFreeBlock* block = reinterpret_cast<FFreeBlock*>(header);
+        block->Next = cache.FreeLists[sizeClass];
+        cache.FreeLists[sizeClass] = block;
+        cache.NumFree[sizeClass]++;
+        if (cache.NumFree[sizeClass] > c_MaxThreadCachedBlocks)
+        {
+            Flush(sizeClass, cache, c_MaxThreadCachedBlocks - c_PoolTransferBlocks);
+        }
+    }
+
+    void FTritonPooledMemHook::LogUsageReport() const
+    {
+        UE_LOG(
+            LogAcousticsRuntime,
+            Display,
+            TEXT("Triton pooled memory, %lld KB in slabs:"),
+            FPlatformAtomics::AtomicRead(&m_SlabBytes) / 1024);
+        UE_LOG(LogAcousticsRuntime, Display, TEXT("  Size   Live blocks   Slab blocks   Live KB   Slab KB   Unused"));
+        for (int32 i = 0; i < c_NumSizeClasses; i++)
+        {
+            const FSizeClass& pool = m_SizeClasses[i];
+            // Slabs are carved by Refill on the streaming threads while this runs
+            int64 numBlocks = 0;
+            int32 numSlabs = 0;
+            {
+                FScopeLock lock(&pool.Lock);
+                numBlocks = pool.NumBlocks;
+                numSlabs = pool.Slabs.Num();
+            }
+            if (numBlocks == 0)
+            {
+                continue;
+            }
+            const int64 numLive = FPlatformAtomics::AtomicRead(&pool.NumLiveBlocks);
+            const int64 blockSize = sizeof(FPoolBlockHeader) + c_SizeClassSizes[i];
+            UE_LOG(
+                LogAcousticsRuntime,
+                Display,
+                TEXT("  %4u   %11lld   %11lld   %7lld   %7lld   %5.1f%%"),
+                c_SizeClassSizes[i],
+                numLive,
+                numBlocks,
+                numLive * blockSize / 1024,
+                static_cast<int64>(numSlabs * c_PoolSlabSize / 1024),
+                100.0 * (1.0 - static_cast<double>(numLive) / numBlocks));
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// IO HOOK
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Read block size
     const size_t FTritonUnrealIOHook::m_ReadCacheSize = 4 * 1024 * 1024;
 
+    // Read-ahead never shrinks below this, so random access still reads in reasonably sized chunks
+    constexpr uint64 c_MinReadAheadSize = 256 * 1024;
+
+    // Background read-ahead of ACE files
+    int32 c_AceReadAhead = 1;
+    static FAutoConsoleVariableRef CVarAcousticsAceReadAhead(
+        TEXT("PA.AceReadAhead"), c_AceReadAhead,
+        TEXT("When non-zero, ACE file reads that run sequentially have the next block read in the background.\n")
+            TEXT("Takes effect on the next read.\n"),
+        ECVF_Default);
+
     uint64 FCachedSyncDiskReader::_DiskRead(uint64 fileOffset, void* destBuffer, uint64 bytesToRead)
     {
         check(IsOK());
 
-        auto request = TUniquePtr<IAsyncReadRequest>(m_FileHandle->ReadRequest(fileOffset, bytesToRead, AIOP_Normal));
+        // Read straight into the destination, rather than into a buffer we'd have to copy out of and free
+        auto request = TUniquePtr<IAsyncReadRequest>(m_FileHandle->ReadRequest(
+            fileOffset, bytesToRead, AIOP_Normal, nullptr, static_cast<uint8*>(destBuffer)));
         if (!request->WaitCompletion())
         {
             // Something went wrong with loading
             return -1;
         }
-        auto result = request->GetReadResults();
 
-        if (result == nullptr)
+        // Ideally, we'd also call GetReadSize() here, but it never returns a valid size even on successful reads
+        if (request->GetReadResults() == nullptr)
         {
             return 0;
         }
 
-        // Ideally, we'd also call GetReadSize() here, but it never returns a valid size even on successful reads
-        FMemory::Memcpy(destBuffer, result, bytesToRead);
-        // By contract, we must call free on the result buffer now that we're done with it
-        FMemory::Free(result);
-
 #if !UE_BUILD_SHIPPING
         INC_DWORD_STAT_BY(STAT_Acoustics_FileReads, bytesToRead);
         m_BytesRead += static_cast<int64>(bytesToRead);
@@ -160,16 +505,146 @@ namespace TritonRuntime
         return bytesToRead;
     }
 
-    FCachedSyncDiskReader::FCachedSyncDiskReader(const FString& fileName, uint64 cacheSize)
-        : m_FileName(fileName), m_CacheSize(cacheSize), m_CacheFileOffset(0), m_IsCacheInvalid(true), m_BytesRead(0)
+    bool FCachedSyncDiskReader::_FillBlock(FReadBlock& block, uint64 fileOffset, uint64 minBytes)
+    {
+        check(block.Request == nullptr);
+
+        const uint64 distToFileEnd = m_FileSize - fileOffset;
+        const uint64 diskReadSize =
+            FMath::Min(distToFileEnd, FMath::Max(static_cast<uint64>(m_ReadAheadSize), minBytes));
+
+#if !UE_BUILD_SHIPPING
+        const double startSeconds = FPlatformTime::Seconds();
+#endif
+        const uint64 actuallyRead = _DiskRead(fileOffset, block.Data.GetData(), diskReadSize);
+#if !UE_BUILD_SHIPPING
+        INC_FLOAT_STAT_BY(STAT_Acoustics_FileReadStallMs, (FPlatformTime::Seconds() - startSeconds) * 1000.0);
+#endif
+
+        // Failed read request, block contents are unknown now
+        block.IsValid = (actuallyRead == diskReadSize);
+        block.FileOffset = fileOffset;
+        block.Size = block.IsValid ? diskReadSize : 0;
+        return block.IsValid;
+    }
+
+    void FCachedSyncDiskReader::_StartReadAhead(FReadBlock& block, uint64 fileOffset)
+    {
+        check(block.Request == nullptr);
+
+        block.IsValid = false;
+        block.FileOffset = fileOffset;
+        block.Size = FMath::Min(static_cast<uint64>(m_FileSize) - fileOffset, static_cast<uint64>(m_ReadAheadSize));
+        block.Request.Reset(
+            m_FileHandle->ReadRequest(fileOffset, block.Size, AIOP_Normal, nullptr, block.Data.GetData()));
+    }
+
+    bool FCachedSyncDiskReader::_FinishReadAhead(FReadBlock& block)
     {
-        m_CacheData.Reserve(cacheSize);
+        if (block.Request == nullptr)
+        {
+            return block.IsValid;
+        }
+
+        // Only count the wait if Triton actually caught up with the disk
+        if (!block.Request->PollCompletion())
+        {
+#if !UE_BUILD_SHIPPING
+            const double startSeconds = FPlatformTime::Seconds();
+#endif
+            block.Request->WaitCompletion();
+#if !UE_BUILD_SHIPPING
+            INC_FLOAT_STAT_BY(STAT_Acoustics_FileReadStallMs, (FPlatformTime::Seconds() - startSeconds) * 1000.0);
+#endif
+        }
+
+        block.IsValid = block.Request->GetReadResults() != nullptr;
+        block.Request.Reset();
 
+#if !UE_BUILD_SHIPPING
+        if (block.IsValid)
+        {
+            INC_DWORD_STAT_BY(STAT_Acoustics_FileReads, block.Size);
+            INC_DWORD_STAT(STAT_Acoustics_ReadAheadHits);
+            m_BytesRead += static_cast<int64>(block.Size);
+        }
+#endif
+        return block.IsValid;
+    }
+
+    void FCachedSyncDiskReader::_CancelReadAhead(FReadBlock& block)
+    {
+        if (block.Request != nullptr)
+        {
+            // Requests must be complete before they're deleted
+            block.Request->Cancel();
+            block.Request->WaitCompletion();
+            block.Request.Reset();
+        }
+        block.IsValid = false;
+    }
+
+    FCachedSyncDiskReader::FReadBlock* FCachedSyncDiskReader::_FindBlock(uint64 fileOffset)
+    {
+        FReadBlock& current = m_Blocks[m_CurrentBlock];
+        if (current.IsValid && current.Contains(fileOffset))
+        {
+            return &current;
+        }
+
+        FReadBlock& ahead = m_Blocks[1 - m_CurrentBlock];
+        if ((ahead.IsValid || ahead.Request != nullptr) && ahead.Contains(fileOffset))
+        {
+            // The other block may also just be the previous current block, if Triton stepped back into it
+            const bool isReadAhead = ahead.Request != nullptr;
+            if (!_FinishReadAhead(ahead))
+            {
+                return nullptr;
+            }
+
+            m_CurrentBlock = 1 - m_CurrentBlock;
+            if (isReadAhead)
+            {
+                // Triton has caught up with the read-ahead, so read further ahead next time
+                m_ReadAheadSize = FMath::Min(m_ReadAheadSize * 2, m_CacheSize);
+            }
+            return &ahead;
+        }
+        return nullptr;
+    }
+
+    void FCachedSyncDiskReader::_UpdateAccessPattern(uint64 readOffset, uint64 bytesToRead)
+    {
+        // Small forward skips still count as sequential, Triton seeks over data it doesn't need
+        if (readOffset >= m_LastReadEnd && readOffset - m_LastReadEnd < m_ReadAheadSize)
+        {
+            m_SequentialReads++;
+        }
+        else
+        {
+            m_SequentialReads = 0;
+        }
+        m_LastReadEnd = readOffset + bytesToRead;
+    }
+
+    FCachedSyncDiskReader::FCachedSyncDiskReader(const FString& fileName, uint64 cacheSize)
+        : m_FileName(fileName)
+        , m_CurrentBlock(0)
+        , m_CacheSize(cacheSize)
+        , m_ReadAheadSize(cacheSize)
+        , m_LastReadEnd(0)
+        , m_SequentialReads(0)
+        , m_BytesRead(0)
+    {
         m_FileSize = IFileManager::Get().FileSize(*fileName);
         // If there were any errors, such as file not found, m_FileSize will be -1
         if (m_FileSize != -1)
         {
             m_FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*m_FileName));
+            for (FReadBlock& block : m_Blocks)
+            {
+                block.Data.SetNumUninitialized(cacheSize);
+            }
         }
     }
 
@@ -180,8 +655,16 @@ namespace TritonRuntime
 
     FCachedSyncDiskReader::~FCachedSyncDiskReader()
     {
+        // Outstanding reads write into our blocks, and must finish before the file handle goes away
+        for (FReadBlock& block : m_Blocks)
+        {
+            _CancelReadAhead(block);
+        }
+
 #if !UE_BUILD_SHIPPING
         SET_DWORD_STAT(STAT_Acoustics_FileReads, 0);
+        SET_DWORD_STAT(STAT_Acoustics_ReadAheadHits, 0);
+        SET_FLOAT_STAT(STAT_Acoustics_FileReadStallMs, 0);
 #endif
     }
 
@@ -199,47 +682,52 @@ namespace TritonRuntime
             return 0;
         }
 
+        _UpdateAccessPattern(readOffset, bytesToRead);
+
         if (bytesToRead >= m_CacheSize) // big read, bypass cache
         {
             return _DiskRead(readOffset, destBuffer, bytesToRead);
         }
 
-        bool cacheHit;
-
-        if (m_IsCacheInvalid)
+        // A read can straddle the end of one block and the start of the next, so copy it out a block at a time
+        unsigned char* dest = static_cast<unsigned char*>(destBuffer);
+        uint64 fileOffset = readOffset;
+        uint64 bytesLeft = bytesToRead;
+        while (bytesLeft > 0)
         {
-            cacheHit = false;
-        }
-        else
-        {
-            cacheHit = (readOffset >= m_CacheFileOffset && readOffset + bytesToRead <= m_CacheFileOffset + m_CacheSize);
-        }
-
-        if (cacheHit)
-        {
-            memcpy(destBuffer, m_CacheData.GetData() + readOffset - m_CacheFileOffset, bytesToRead);
-            return bytesToRead;
-        }
-        else // Cache miss: Update cache and recurse
-        {
-            uint64 distToFileEnd = m_FileSize - readOffset;
-            uint64 diskReadSize = FMath::Min(distToFileEnd, static_cast<uint64>(m_CacheSize));
-            uint64 actuallyRead = _DiskRead(readOffset, m_CacheData.GetData(), diskReadSize);
-            // Failed read request, cache contents are unknown now, invalidate it
-            if (actuallyRead < diskReadSize)
+            FReadBlock* block = _FindBlock(fileOffset);
+            if (block == nullptr)
             {
-                m_IsCacheInvalid = true;
-                return 0;
+                // Miss: whatever is being read ahead is no use, so drop it and read this block now
+                m_ReadAheadSize = FMath::Max(m_ReadAheadSize / 2, static_cast<size_t>(c_MinReadAheadSize));
+                _CancelReadAhead(m_Blocks[1 - m_CurrentBlock]);
+                block = &m_Blocks[m_CurrentBlock];
+                if (!_FillBlock(*block, fileOffset, bytesLeft))
+                {
+                    return 0;
+                }
             }
 
-            m_IsCacheInvalid = false;
-            m_CacheFileOffset = readOffset;
+            const uint64 bytesFromBlock = FMath::Min(bytesLeft, block->FileOffset + block->Size - fileOffset);
+            FMemory::Memcpy(dest, block->Data.GetData() + (fileOffset - block->FileOffset), bytesFromBlock);
+            dest += bytesFromBlock;
+            fileOffset += bytesFromBlock;
+            bytesLeft -= bytesFromBlock;
+        }
 
-            // recurse, this time cache will be hit
-            return Read(readOffset, destBuffer, bytesToRead);
+        // Reads are running sequentially, so keep the next block coming while Triton works through this one
+        const FReadBlock& current = m_Blocks[m_CurrentBlock];
+        FReadBlock& ahead = m_Blocks[1 - m_CurrentBlock];
+        const uint64 nextOffset = current.FileOffset + current.Size;
+        const bool isAheadQueued = (ahead.IsValid || ahead.Request != nullptr) && ahead.FileOffset == nextOffset;
+        if (c_AceReadAhead != 0 && m_SequentialReads > 0 && nextOffset < static_cast<uint64>(m_FileSize) &&
+            !isAheadQueued)
+        {
+            _CancelReadAhead(ahead);
+            _StartReadAhead(ahead, nextOffset);
         }
 
-        //return -1;
+        return bytesToRead;
     }
 
     int64 FCachedSyncDiskReader::GetBytesRead() const
@@ -247,7 +735,7 @@ namespace TritonRuntime
         return m_BytesRead;
     }
 
-    FTritonUnrealIOHook::FTritonUnrealIOHook()
+    FTritonUnrealIOHook::FTritonUnrealIOHook() : m_FileOffset(0)
     {
     }
 
@@ -273,16 +761,15 @@ namespace TritonRuntime
         return (bytesActuallyRead / elementSize);
     }
 
-    bool FTritonUnrealIOHook::Seek(uint32_t offset)
+    bool FTritonUnrealIOHook::Seek64(uint64 offset)
     {
-        m_FileOffset = static_cast<uint64>(offset);
+        m_FileOffset = offset;
         return true;
     }
 
-    bool FTritonUnrealIOHook::SeekFromCurrent(uint32_t offset)
+    uint64 FTritonUnrealIOHook::Tell64() const
     {
-        m_FileOffset += static_cast<uint64>(offset);
-        return true;
+        return m_FileOffset;
     }
 
     int64 FTritonUnrealIOHook::GetFileSize() const
@@ -302,22 +789,248 @@ namespace TritonRuntime
         return m_DiskReader != nullptr ? m_DiskReader->GetBytesRead() : 0;
     }
 
+    // How far ahead of sequential reads to hint the OS to page in a memory-mapped ACE file
+    constexpr uint64 c_MappedPreloadSize = 4 * 1024 * 1024;
+
+    FTritonMappedIOHook::FTritonMappedIOHook()
+        : m_MappedData(nullptr), m_FileSize(-1), m_FileOffset(0), m_PreloadEnd(0), m_BytesRead(0)
+    {
+    }
+
+    FTritonMappedIOHook::~FTritonMappedIOHook()
+    {
+        Close();
+    }
+
+    bool FTritonMappedIOHook::OpenForRead(const char* name)
+    {
+        Close();
+
+        const FString fileName(name);
+        m_FileSize = IFileManager::Get().FileSize(*fileName);
+        if (m_FileSize <= 0)
+        {
+            return false;
+        }
+
+        // Fails for files that can't be mapped, such as those inside PAK files
+        m_MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*fileName));
+        if (m_MappedHandle == nullptr)
+        {
+            return false;
+        }
+
+        m_MappedRegion.Reset(m_MappedHandle->MapRegion(0, m_FileSize));
+        if (m_MappedRegion == nullptr)
+        {
+            m_MappedHandle.Reset();
+            return false;
+        }
+
+        m_MappedData = m_MappedRegion->GetMappedPtr();
+        return true;
+    }
+
+    size_t FTritonMappedIOHook::Read(void* destBuffer, size_t elementSize, size_t numElementsToRead)
+    {
+        check(m_MappedData != nullptr);
+
+        const uint64 bytesToRead = elementSize * numElementsToRead;
+        if (m_FileOffset + bytesToRead > static_cast<uint64>(m_FileSize)) // Reading past EOF
+        {
+            return 0;
+        }
+
+        // Hint the range after this read once we get close to the end of the last one hinted, or if we've jumped
+        // back well before it. Triton loads tiles front to back, so this keeps page faults off the loading thread
+        const uint64 readEnd = m_FileOffset + bytesToRead;
+        if (readEnd + c_MappedPreloadSize / 2 >= m_PreloadEnd || readEnd + 2 * c_MappedPreloadSize < m_PreloadEnd)
+        {
+            const uint64 preloadSize = FMath::Min(c_MappedPreloadSize, static_cast<uint64>(m_FileSize) - readEnd);
+            if (preloadSize > 0)
+            {
+                m_MappedRegion->PreloadHint(readEnd, preloadSize);
+            }
+            m_PreloadEnd = readEnd + preloadSize;
+        }
+
+        FMemory::Memcpy(destBuffer, m_MappedData + m_FileOffset, bytesToRead);
+        m_FileOffset = readEnd;
+
+#if !UE_BUILD_SHIPPING
+        INC_DWORD_STAT_BY(STAT_Acoustics_FileReads, bytesToRead);
+        m_BytesRead += static_cast<int64>(bytesToRead);
+#endif
+
+        return numElementsToRead;
+    }
+
+    bool FTritonMappedIOHook::Seek64(uint64 offset)
+    {
+        m_FileOffset = offset;
+        return true;
+    }
+
+    uint64 FTritonMappedIOHook::Tell64() const
+    {
+        return m_FileOffset;
+    }
+
+    bool FTritonMappedIOHook::Close()
+    {
+        // The region has to be unmapped before its file is closed
+        m_MappedRegion.Reset();
+        m_MappedHandle.Reset();
+        m_MappedData = nullptr;
+        m_FileOffset = 0;
+        m_PreloadEnd = 0;
+
+#if !UE_BUILD_SHIPPING
+        if (m_BytesRead > 0)
+        {
+            SET_DWORD_STAT(STAT_Acoustics_FileReads, 0);
+            m_BytesRead = 0;
+        }
+#endif
+        return true;
+    }
+
+    int64 FTritonMappedIOHook::GetFileSize() const
+    {
+        return m_FileSize;
+    }
+
+    int64 FTritonMappedIOHook::GetBytesRead() const
+    {
+        return m_BytesRead;
+    }
+
+    constexpr uint32 c_IOTraceMagic = 0x4F494150; // 'PAIO'
+    constexpr uint32 c_IOTraceVersion = 1;
+
+    FTritonRecordingIOHook::FTritonRecordingIOHook(
+        TUniquePtr<FTritonFileIOHook>&& inner, const FString& fileName, const FString& traceFileName)
+        : m_Inner(MoveTemp(inner)), m_LastRecordSeconds(FPlatformTime::Seconds())
+    {
+        m_Trace.Reset(IFileManager::Get().CreateFileWriter(*traceFileName));
+        if (m_Trace == nullptr)
+        {
+            UE_LOG(LogAcousticsRuntime, Warning, TEXT("Failed to create ACE IO trace file: [%s]"), *traceFileName);
+            return;
+        }
+
+        uint32 magic = c_IOTraceMagic;
+        uint32 version = c_IOTraceVersion;
+        int64 fileSize = m_Inner->GetFileSize();
+        FTCHARToUTF8 name(*fileName);
+        uint32 nameLength = static_cast<uint32>(name.Length());
+        *m_Trace << magic << version << fileSize << nameLength;
+        m_Trace->Serialize((void*) name.Get(), nameLength);
+
+        UE_LOG(LogAcousticsRuntime, Log, TEXT("Recording ACE IO trace to [%s]"), *traceFileName);
+    }
+
+    FTritonRecordingIOHook::~FTritonRecordingIOHook()
+    {
+        // The inner hook closes itself. Anything left in the trace is flushed when it is destroyed
+    }
+
+    void FTritonRecordingIOHook::WriteRecord(
+        EOp op, double startSeconds, uint64 position, uint64 bytesRequested, uint64 result)
+    {
+        if (m_Trace == nullptr)
+        {
+            return;
+        }
+
+        const double endSeconds = FPlatformTime::Seconds();
+        // Saturate rather than wrap, if a gap is ever longer than an hour or so
+        auto toMicroseconds = [](double seconds) -> uint32
+        { return static_cast<uint32>(FMath::Clamp(seconds * 1.0e6, 0.0, static_cast<double>(MAX_uint32))); };
+
+        uint8 opCode = static_cast<uint8>(op);
+        uint32 sinceLastUs = toMicroseconds(startSeconds - m_LastRecordSeconds);
+        uint32 durationUs = toMicroseconds(endSeconds - startSeconds);
+        uint32 size = static_cast<uint32>(FMath::Min(bytesRequested, static_cast<uint64>(MAX_uint32)));
+        uint32 outcome = static_cast<uint32>(FMath::Min(result, static_cast<uint64>(MAX_uint32)));
+        *m_Trace << opCode << sinceLastUs << durationUs << position << size << outcome;
+
+        m_LastRecordSeconds = startSeconds;
+    }
+
+    bool FTritonRecordingIOHook::OpenForRead(const char* name)
+    {
+        const double startSeconds = FPlatformTime::Seconds();
+        const bool result = m_Inner->OpenForRead(name);
+        WriteRecord(EOp::OpenForRead, startSeconds, 0, 0, result ? 1 : 0);
+        return result;
+    }
+
+    size_t FTritonRecordingIOHook::Read(void* destBuffer, size_t elementSize, size_t numElementsToRead)
+    {
+        const double startSeconds = FPlatformTime::Seconds();
+        const uint64 position = m_Inner->Tell64();
+        const size_t elementsRead = m_Inner->Read(destBuffer, elementSize, numElementsToRead);
+        WriteRecord(EOp::Read, startSeconds, position, elementSize * numElementsToRead, elementSize * elementsRead);
+        return elementsRead;
+    }
+
+    bool FTritonRecordingIOHook::Seek64(uint64 offset)
+    {
+        const double startSeconds = FPlatformTime::Seconds();
+        const bool result = m_Inner->Seek64(offset);
+        WriteRecord(EOp::Seek, startSeconds, offset, 0, result ? 1 : 0);
+        return result;
+    }
+
+    uint64 FTritonRecordingIOHook::Tell64() const
+    {
+        return m_Inner->Tell64();
+    }
+
+    bool FTritonRecordingIOHook::Close()
+    {
+        const double startSeconds = FPlatformTime::Seconds();
+        const bool result = m_Inner->Close();
+        WriteRecord(EOp::Close, startSeconds, 0, 0, result ? 1 : 0);
+        if (m_Trace != nullptr)
+        {
+            m_Trace->Flush();
+        }
+        return result;
+    }
+
+    int64 FTritonRecordingIOHook::GetFileSize() const
+    {
+        return m_Inner->GetFileSize();
+    }
+
+    int64 FTritonRecordingIOHook::GetBytesRead() const
+    {
+        return m_Inner->GetBytesRead();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// TASK HOOK
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     class FTritonLoadAsyncTask : public IQueuedWork
     {
     public:
-        FTritonLoadAsyncTask(TFunction<void()>&& inFunction, volatile int32* inDoneCounter)
-            : m_Function(inFunction), m_DoneCounter(inDoneCounter)
+        FTritonLoadAsyncTask(TUniquePtr<TaskFunc>&& inTask, FTritonAsyncTaskHook* inHook)
+            : m_Task(MoveTemp(inTask)), m_Hook(inHook)
         {
         }
 
         virtual void DoThreadedWork() override
         {
-            SCOPED_NAMED_EVENT_TEXT("Triton Streaming", FColor::Green);
-            m_Function();
-            FPlatformAtomics::InterlockedDecrement(m_DoneCounter);
+            {
+                SCOPED_NAMED_EVENT_TEXT("Triton Streaming", FColor::Green);
+                m_Task->Execute();
+            }
+            // The thread pool doesn't own its work, so we clean up after ourselves
+            m_Task.Reset();
+            m_Hook->OnTaskFinished(true);
+            delete this;
         }
 
         /**
@@ -328,42 +1041,62 @@ namespace TritonRuntime
          */
         virtual void Abandon() override
         {
-            // most implementations of IQueuedWork do this to signal completion.
-            FPlatformAtomics::InterlockedDecrement(m_DoneCounter);
+            // Only happens when the thread pool itself is destroyed at engine shutdown
+            m_Task.Reset();
+            m_Hook->OnTaskFinished(false);
+            delete this;
         }
 
-        /** The function to execute on the Task Graph. */
-        TFunction<void()> m_Function;
-
-        volatile int32* m_DoneCounter;
+    private:
+        // Our own copy of the task, Triton's copy only lives as long as the Launch call
+        TUniquePtr<TaskFunc> m_Task;
+        FTritonAsyncTaskHook* m_Hook;
     };
 
-    FTritonAsyncTaskHook::FTritonAsyncTaskHook() : m_NumRunningTasks(0)
+    FTritonAsyncTaskHook::FTritonAsyncTaskHook()
+        : m_LaunchPriority(EQueuedWorkPriority::Normal), m_NumCompletedTasks(0)
     {
     }
 
     FTritonAsyncTaskHook::~FTritonAsyncTaskHook()
     {
+        // Tasks hold on to the hook, so they all need to be gone first
+        m_NumRunningTasks.Drain(TEXT("~FTritonAsyncTaskHook"));
     }
 
     void FTritonAsyncTaskHook::Launch(const TaskFunc* task)
     {
         // Make a local deep copy of Task, as the object has no existence guarantee beyond this call
-        m_TaskFunc.Reset(task->Clone());
-        TFunction<void()> Function([this]() { m_TaskFunc->Execute(); });
+        TUniquePtr<TaskFunc> taskCopy(task->Clone());
 
-        FPlatformAtomics::InterlockedIncrement(&m_NumRunningTasks);
+        m_NumRunningTasks.Increment();
 
-        GThreadPool->AddQueuedWork(new FTritonLoadAsyncTask(MoveTemp(Function), &m_NumRunningTasks));
+        // Triton expects every launched task to run, so the priority only decides where it goes in the pool's queue
+        const EQueuedWorkPriority priority =
+            static_cast<EQueuedWorkPriority>(FPlatformAtomics::AtomicRead(&m_LaunchPriority));
+        GThreadPool->AddQueuedWork(new FTritonLoadAsyncTask(MoveTemp(taskCopy), this), priority);
     }
 
-    void FTritonAsyncTaskHook::Wait()
+    void FTritonAsyncTaskHook::OnTaskFinished(bool hasExecuted)
     {
-        // Busy loop. Called only during map unload when doing non-blocking streaming.
-        while (m_NumRunningTasks > 0)
+        if (hasExecuted)
         {
-            FPlatformProcess::Sleep(0);
+            FPlatformAtomics::InterlockedIncrement(&m_NumCompletedTasks);
         }
+
+        // Last, as Wait() can return and the hook be destroyed as soon as this hits zero
+        m_NumRunningTasks.Decrement();
+    }
+
+    void FTritonAsyncTaskHook::SetLaunchPriority(EQueuedWorkPriority priority)
+    {
+        FPlatformAtomics::InterlockedExchange(&m_LaunchPriority, static_cast<int32>(priority));
+    }
+
+    void FTritonAsyncTaskHook::Wait()
+    {
+        // Called only during map unload when doing non-blocking streaming. Sleeps until the last task signals
+        m_NumRunningTasks.Drain(TEXT("FTritonAsyncTaskHook::Wait"));
     }
 
     // Used by triton to synchronize and update internal work queue shared with async task
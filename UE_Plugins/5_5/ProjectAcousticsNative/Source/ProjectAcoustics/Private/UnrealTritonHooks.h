@@ -5,8 +5,18 @@
 
 #include "TritonHooks.h"
 #include "Async/AsyncFileHandle.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/QueuedThreadPool.h"
 #include "Stats/Stats2.h"
 #include "IAcoustics.h"
+#include "AcousticsTaskCounter.h"
+#include "AcousticsMemoryTrace.h"
+
+// Triton's memory use is counted in non-shipping builds. Define ACOUSTICS_TRACK_MEMORY=1 to count it in shipping
+// builds too, which a probe memory budget (PA.ProbeBudgetMB) needs
+#ifndef ACOUSTICS_TRACK_MEMORY
+#define ACOUSTICS_TRACK_MEMORY !UE_BUILD_SHIPPING
+#endif
 
 namespace TritonRuntime
 {
@@ -24,30 +34,127 @@ namespace TritonRuntime
     // Routes all of Triton's internal new/deletes to UE's FMemory::* versions.
     class FTritonMemHook : public ITritonMemHook
     {
+    protected:
         volatile int64 m_TotalMemoryUsed;
+
+    private:
         virtual void* Malloc(size_t inSize);
         virtual void* Realloc(void* inPtr, size_t size);
         virtual void Free(void* inPtr);
 
     public:
         FTritonMemHook();
+        virtual ~FTritonMemHook() = default;
         int64 GetTotalMemoryUsed() const;
+
+#if ACOUSTICS_MEMORY_TRACING
+        // Tags traced allocations with the scope Triton is allocating for
+        virtual void StartAllocationScope(const wchar_t* scopeName) override;
+        virtual void StopAllocationScope(const wchar_t* scopeName) override;
+#endif
+    };
+
+    // Alternative memory hook that serves Triton's small allocations from size-class pools, so the many small
+    // blocks allocated while loading probes don't each go through the general-purpose allocator. All operations are
+    // thread-safe.
+    // Each pool carves 64KB slabs into blocks of one size. Freed blocks go onto a per-thread cache first, and only
+    // move to the pool's locked central free list in batches, so most allocations and frees take no lock. Every
+    // block carries a 16 byte header recording its size class, which keeps the returned memory 16 byte aligned.
+    // Larger allocations go straight to FMemory. Slabs are only returned to the system when the hook is destroyed.
+    // Only one pooled hook should exist at a time, as the per-thread caches belong to the newest one.
+    class FTritonPooledMemHook : public FTritonMemHook
+    {
+    public:
+        static constexpr int32 c_NumSizeClasses = 16;
+
+        FTritonPooledMemHook();
+        virtual ~FTritonPooledMemHook();
+
+        // Logs live and slab memory for each size class, and how much of the slab memory is unused
+        void LogUsageReport() const;
+
+    private:
+        virtual void* Malloc(size_t inSize) override;
+        virtual void* Realloc(void* inPtr, size_t size) override;
+        virtual void Free(void* inPtr) override;
+
+        struct FFreeBlock
+        {
+            FFreeBlock* Next;
+        };
+
+        struct FSizeClass
+        {
+            // Guards everything but the live block count
+            mutable FCriticalSection Lock;
+            FFreeBlock* FreeList = nullptr;
+            TArray<void*> Slabs;
+            int64 NumBlocks = 0;
+            volatile int64 NumLiveBlocks = 0;
+        };
+
+        struct FThreadCache;
+        FThreadCache& GetThreadCache();
+        // Moves blocks from the central list to the thread's cache, carving a new slab if the list is empty.
+        // Returns false if a new slab was needed and couldn't be allocated
+        bool Refill(int32 sizeClass, FThreadCache& cache);
+        void Flush(int32 sizeClass, FThreadCache& cache, int32 numToKeep);
+        static size_t GetUsableSize(void* inPtr);
+
+        FSizeClass m_SizeClasses[c_NumSizeClasses];
+        // Size class for each 16 byte step of allocation size, up to the largest class
+        uint8 m_SizeClassLookup[257];
+        // Distinguishes this hook from earlier ones in the per-thread caches
+        uint32 m_Id;
+        volatile int64 m_SlabBytes;
     };
 
     // Handles file I/O for UFS.
+    // Keeps two blocks of the file in memory. Triton reads out of the current block while the block after it is read
+    // in the background, so sequential loads rarely have to wait on the disk. Read-ahead only starts once reads run
+    // sequentially, and its size adapts: it grows each time Triton moves on to a block that was read ahead, and
+    // shrinks each time a random access forces a blocking read.
     class FCachedSyncDiskReader
     {
     private:
+        struct FReadBlock
+        {
+            TArray<unsigned char> Data;
+            uint64 FileOffset = 0;
+            uint64 Size = 0;
+            // Background read filling Data, if one is in flight
+            TUniquePtr<IAsyncReadRequest> Request;
+            // Data holds [FileOffset, FileOffset + Size) of the file
+            bool IsValid = false;
+
+            bool Contains(uint64 fileOffset) const
+            {
+                return fileOffset >= FileOffset && fileOffset < FileOffset + Size;
+            }
+        };
+
         FString m_FileName;
         TUniquePtr<IAsyncReadFileHandle> m_FileHandle;
 
-        TArray<unsigned char> m_CacheData;
+        // Reads are served from m_Blocks[m_CurrentBlock]. The other block is the read-ahead
+        FReadBlock m_Blocks[2];
+        int32 m_CurrentBlock;
+        // Size each block is allocated at, and how much of it is currently filled per read
         size_t m_CacheSize;
-        size_t m_CacheFileOffset;
-        bool m_IsCacheInvalid;
+        size_t m_ReadAheadSize;
+
+        // Where the previous read ended, and how many reads in a row have carried on from there
+        uint64 m_LastReadEnd;
+        int32 m_SequentialReads;
 
         int64 m_FileSize;
         uint64 _DiskRead(uint64 fileOffset, void* destBuffer, uint64 bytesToRead);
+        bool _FillBlock(FReadBlock& block, uint64 fileOffset, uint64 minBytes);
+        void _StartReadAhead(FReadBlock& block, uint64 fileOffset);
+        bool _FinishReadAhead(FReadBlock& block);
+        void _CancelReadAhead(FReadBlock& block);
+        FReadBlock* _FindBlock(uint64 fileOffset);
+        void _UpdateAccessPattern(uint64 readOffset, uint64 bytesToRead);
 
         volatile int64 m_BytesRead;
 
@@ -60,9 +167,37 @@ namespace TritonRuntime
         int64 GetBytesRead() const;
     };
 
+    // 64-bit extension of Triton's I/O hook. ITritonIOHook seeks with 32-bit offsets, which can't address past 4GB.
+    // Hooks implementing this keep a 64-bit file position, and Seek/SeekFromCurrent are implemented in terms of it
+    class ITritonIOHook64 : public ITritonIOHook
+    {
+    public:
+        virtual bool Seek64(uint64 offset) = 0;
+        virtual uint64 Tell64() const = 0;
+
+        virtual bool Seek(uint32_t offset) override
+        {
+            return Seek64(static_cast<uint64>(offset));
+        }
+
+        // Relative seeks are done in 64 bits, so they still work once the position is past 4GB
+        virtual bool SeekFromCurrent(uint32_t offset) override
+        {
+            return Seek64(Tell64() + static_cast<uint64>(offset));
+        }
+    };
+
+    // Triton I/O hook reading a single file, with the file size and read counters the module reports
+    class FTritonFileIOHook : public ITritonIOHook64
+    {
+    public:
+        virtual int64 GetFileSize() const = 0;
+        virtual int64 GetBytesRead() const = 0;
+    };
+
     // Implements Triton's Interface for blocking I/O from a single file/asset. Operations need not be thread-safe.
     // Allows ACE files to be retrieved from PAK files
-    class FTritonUnrealIOHook : public ITritonIOHook
+    class FTritonUnrealIOHook : public FTritonFileIOHook
     {
     private:
         uint64 m_FileOffset;
@@ -74,22 +209,105 @@ namespace TritonRuntime
         virtual ~FTritonUnrealIOHook();
         virtual bool OpenForRead(const char* name) override;
         virtual size_t Read(void* destBuffer, size_t elementSize, size_t numElementsToRead) override;
-        virtual bool Seek(uint32_t offset) override;
-        virtual bool SeekFromCurrent(uint32_t offset) override;
+        virtual bool Seek64(uint64 offset) override;
+        virtual uint64 Tell64() const override;
         virtual bool Close() override;
-        int64 GetFileSize() const;
-        int64 GetBytesRead() const;
+        virtual int64 GetFileSize() const override;
+        virtual int64 GetBytesRead() const override;
+    };
+
+    // Implements Triton's Interface for blocking I/O by memory-mapping a whole ACE file. Operations need not be
+    // thread-safe.
+    // Reads are copied straight out of the mapping with no intermediate cache, and the OS pages the file in as it's
+    // touched. Pages ahead of sequential reads are hinted for preloading. Only loose files can be mapped, so opening
+    // a file inside a PAK file fails, and the caller should fall back to FTritonUnrealIOHook.
+    class FTritonMappedIOHook : public FTritonFileIOHook
+    {
+    private:
+        TUniquePtr<IMappedFileHandle> m_MappedHandle;
+        TUniquePtr<IMappedFileRegion> m_MappedRegion;
+        const uint8* m_MappedData;
+        int64 m_FileSize;
+        uint64 m_FileOffset;
+        // End of the range last hinted for preloading
+        uint64 m_PreloadEnd;
+
+        volatile int64 m_BytesRead;
+
+    public:
+        FTritonMappedIOHook();
+        virtual ~FTritonMappedIOHook();
+        virtual bool OpenForRead(const char* name) override;
+        virtual size_t Read(void* destBuffer, size_t elementSize, size_t numElementsToRead) override;
+        virtual bool Seek64(uint64 offset) override;
+        virtual uint64 Tell64() const override;
+        virtual bool Close() override;
+        virtual int64 GetFileSize() const override;
+        virtual int64 GetBytesRead() const override;
+    };
+
+    // Decorates another file I/O hook, passing every call through and recording it to a binary trace file, so the
+    // I/O pattern Triton generates while streaming can be studied offline. Operations need not be thread-safe.
+    //
+    // Trace format, all little-endian:
+    //   Header:  uint32 Magic ('PAIO'), uint32 Version (1), int64 FileSize,
+    //            uint32 NameLength, then NameLength bytes of UTF-8 file name
+    //   Records: uint8 Op (0 = OpenForRead, 1 = Read, 2 = Seek, 3 = Close),
+    //            uint32 microseconds since the previous record started (since the header, for the first one),
+    //            uint32 microseconds the call took,
+    //            uint64 file position before the call (for Seek, the position sought to),
+    //            uint32 bytes requested (0 for anything but Read),
+    //            uint32 bytes read for Read, otherwise 1 if the call succeeded and 0 if it failed
+    //
+    // Traces are replayed outside the engine by the AceIOTraceReplay tool, in the plugin's Tools folder
+    class FTritonRecordingIOHook : public FTritonFileIOHook
+    {
+    private:
+        enum class EOp : uint8
+        {
+            OpenForRead = 0,
+            Read = 1,
+            Seek = 2,
+            Close = 3
+        };
+
+        TUniquePtr<FTritonFileIOHook> m_Inner;
+        TUniquePtr<FArchive> m_Trace;
+        double m_LastRecordSeconds;
+
+        void WriteRecord(EOp op, double startSeconds, uint64 position, uint64 bytesRequested, uint64 result);
+
+    public:
+        // Takes ownership of inner, which should already be open, and starts a trace of it at traceFileName
+        FTritonRecordingIOHook(
+            TUniquePtr<FTritonFileIOHook>&& inner, const FString& fileName, const FString& traceFileName);
+        virtual ~FTritonRecordingIOHook();
+        bool IsRecording() const
+        {
+            return m_Trace != nullptr;
+        }
+        virtual bool OpenForRead(const char* name) override;
+        virtual size_t Read(void* destBuffer, size_t elementSize, size_t numElementsToRead) override;
+        virtual bool Seek64(uint64 offset) override;
+        virtual uint64 Tell64() const override;
+        virtual bool Close() override;
+        virtual int64 GetFileSize() const override;
+        virtual int64 GetBytesRead() const override;
     };
 
     // Implements Triton's Interface for launching an asynchronous task.
-    // Queues tasks onto UE's GThreadPool
+    // Queues tasks onto UE's GThreadPool at the current launch priority. Triton launches its streaming tasks strictly
+    // one after another, so there's never more than one to order or throttle, and every launched task is run
     class FTritonAsyncTaskHook : public ITritonAsyncTaskHook
     {
     private:
-        TUniquePtr<TaskFunc> m_TaskFunc;
-        FGraphEventRef m_TaskRef;
         FCriticalSection m_Lock;
-        volatile int32 m_NumRunningTasks;
+        // An EQueuedWorkPriority
+        volatile int32 m_LaunchPriority;
+
+        // Launched tasks that haven't finished yet, whether queued or running
+        FAcousticsTaskCounter m_NumRunningTasks;
+        volatile int32 m_NumCompletedTasks;
 
     public:
         FTritonAsyncTaskHook();
@@ -98,9 +316,34 @@ namespace TritonRuntime
         virtual void Wait() override;
         virtual void Lock() override;
         virtual void Unlock() override;
+
+        // Priority for tasks launched from now on. Raised while loading tiles the listener is already in
+        void SetLaunchPriority(EQueuedWorkPriority priority);
+
+        // Called by tasks once they have run, or been abandoned by a thread pool that is shutting down
+        void OnTaskFinished(bool hasExecuted);
+
+        // Number of tasks launched that haven't finished yet. Non-zero while streaming is loading or unloading
+        int32 GetNumRunningTasks() const
+        {
+            return m_NumRunningTasks.GetCount();
+        }
+
+        // Number of tasks that have finished since this hook was created. Changes whenever streaming has
+        // loaded or unloaded probes
+        int32 GetNumCompletedTasks() const
+        {
+            return FPlatformAtomics::AtomicRead(&m_NumCompletedTasks);
+        }
     };
 } // namespace TritonRuntime
 
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Acoustics Memory Usage"), STAT_Acoustics_Memory, STATGROUP_Acoustics, );
+DECLARE_MEMORY_STAT_EXTERN(
+    TEXT("Acoustics Pooled Slab Memory"), STAT_Acoustics_PooledSlabMemory, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Total Bytes Read"), STAT_Acoustics_FileReads, STATGROUP_Acoustics, );
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
-    TEXT("Acoustics Total Bytes Read"), STAT_Acoustics_FileReads, STATGROUP_Acoustics, );
\ No newline at end of file
+    TEXT("Acoustics Read-Ahead Hits"), STAT_Acoustics_ReadAheadHits, STATGROUP_Acoustics, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics File Read Stall Time (ms)"), STAT_Acoustics_FileReadStallMs, STATGROUP_Acoustics, );
\ No newline at end of file
@@ -60,6 +60,7 @@ private:
 
     void FlattenZ();
     FName Name() const;
+    void SendAttenuation();
 
     UPROPERTY()
     TArray<FVector> Vertices;
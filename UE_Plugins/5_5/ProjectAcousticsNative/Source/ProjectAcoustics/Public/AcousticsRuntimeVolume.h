@@ -26,4 +26,15 @@ public:
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
     FAcousticsDesignParams OverrideDesignParams;
+
+    // Keep this volume's entry in FAcousticsRuntimeVolumeIndex in step with its components and transform
+    virtual void PostRegisterAllComponents() override;
+    virtual void PostUnregisterAllComponents() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(struct FPropertyChangedEvent& e) override;
+#endif
+
+private:
+    void OnTransformUpdated(
+        USceneComponent* component, EUpdateTransformFlags updateTransformFlags, ETeleportType teleport);
 };
\ No newline at end of file
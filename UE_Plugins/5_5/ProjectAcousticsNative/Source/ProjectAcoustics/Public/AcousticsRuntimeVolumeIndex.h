@@ -0,0 +1,78 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AcousticsDesignParams.h"
+
+class AAcousticsRuntimeVolume;
+class UWorld;
+
+// The runtime volumes found around a source at its last lookup. Kept per source by whoever does the lookups, and
+// re-used until the source moves or the set of volumes changes
+struct FAcousticsVolumeLookupCache
+{
+    const UWorld* World = nullptr;
+    FVector Location = FVector::ZeroVector;
+    // Index generation at the last lookup. 0 is never a valid generation, so a new cache always misses
+    uint32 Generation = 0;
+    // Index entries that contained the source
+    TArray<int32, TInlineAllocator<4>> Entries;
+
+    void Reset()
+    {
+        Generation = 0;
+        Entries.Reset();
+    }
+};
+
+// Uniform grid of the bounds of every registered AAcousticsRuntimeVolume, so finding the volumes around a source is a
+// lookup in one grid cell rather than a physics overlap query. Volumes add, update and remove themselves on the game
+// thread. Lookups can come from any thread, including the audio render thread.
+// A volume's shape is taken to be its brush's local bounding box, transformed with the volume.
+class PROJECTACOUSTICS_API FAcousticsRuntimeVolumeIndex
+{
+public:
+    static FAcousticsRuntimeVolumeIndex& Get();
+
+    // Add a volume, or update its bounds if it has moved or changed shape. Game thread only
+    void AddOrUpdate(const AAcousticsRuntimeVolume* volume);
+    // Game thread only
+    void Remove(const AAcousticsRuntimeVolume* volume);
+
+    // Combine the override params of every volume in this world containing the location into designParams. Volumes
+    // whose actor or brush has query collision turned off, or whose brush isn't WorldStatic, are skipped.
+    // The volumes are looked up again only if the location, world or set of volumes changed since the cache was filled
+    void ApplyOverrides(
+        const UWorld* world, const FVector& location, FAcousticsVolumeLookupCache& cache,
+        FAcousticsDesignParams& designParams);
+
+private:
+    FAcousticsRuntimeVolumeIndex();
+
+    struct FEntry
+    {
+        const AAcousticsRuntimeVolume* Volume;
+        const UWorld* World;
+        FTransform Transform;
+        FBox LocalBounds;
+        FBox WorldBounds;
+        // Volumes covering too many cells are kept out of the grid and checked for every lookup
+        bool IsLarge;
+    };
+
+    bool Contains(const FEntry& entry, const UWorld* world, const FVector& location) const;
+    void AddToGrid(const int32 entryId);
+    void RemoveFromGrid(const int32 entryId);
+    FIntVector GetCell(const FVector& location) const;
+
+    FRWLock m_Lock;
+    TSparseArray<FEntry> m_Entries;
+    TMap<const AAcousticsRuntimeVolume*, int32> m_EntryIds;
+    // Entries whose world bounds overlap each cell
+    TMap<FIntVector, TArray<int32>> m_Cells;
+    TArray<int32> m_LargeEntries;
+    // Bumped on every change to the set of volumes or their bounds, so lookup caches know to refresh
+    uint32 m_Generation;
+};
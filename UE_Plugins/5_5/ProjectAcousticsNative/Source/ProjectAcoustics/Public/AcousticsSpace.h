@@ -47,6 +47,30 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
     bool AutoStream;
 
+    /** If enabled, auto streaming loads tiles ahead of the player, extrapolating from their recent velocity and
+     * acceleration. Helps fast-moving players stay within loaded probes. Only applies when AutoStream is enabled.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics", meta = (EditCondition = "AutoStream"))
+    bool PredictiveStreaming;
+
+    /** How far ahead (seconds) to predict player motion when predictive streaming. The tile center is never moved
+     * so far ahead that the player's current position falls out of the safe region of the tile.
+     */
+    UPROPERTY(
+        EditAnywhere, BlueprintReadWrite, Category = "Acoustics",
+        meta = (EditCondition = "AutoStream && PredictiveStreaming", UIMin = 0, ClampMin = 0, UIMax = 5))
+    float PredictionLookaheadSeconds;
+
+    /** Fraction of the tile's safe region the predicted tile center has to drift before a new tile is requested.
+     * Larger values mean fewer loads, but less room to lead the player.
+     */
+    UPROPERTY(
+        EditAnywhere, BlueprintReadWrite, Category = "Acoustics",
+        meta =
+            (EditCondition = "AutoStream && PredictiveStreaming", UIMin = 0.05, ClampMin = 0.05, UIMax = 1,
+             ClampMax = 1))
+    float PredictionHysteresis;
+
     /** Controls the size of the cache used for Acoustic queries. 0 = no cache, 1 = full cache
      * Smaller caches use less RAM, but have longer lookup times
      * Must be set before the ACE file is loaded
@@ -172,8 +196,18 @@ private:
     // Helper to convert from UAcousticsData to a real filepath that Triton can load
     bool LoadAceFile(FString filePath);
     FVector GetListenerPosition();
+    void UpdatePredictiveStreaming(const FVector& listenerPosition, float deltaSeconds);
+    void ResetPredictiveStreaming(const FVector& loadCenter);
     class IAcoustics* m_Acoustics;
 
+    // Smoothed listener motion for predictive streaming
+    FVector m_LastListenerPosition;
+    FVector m_ListenerVelocity;
+    FVector m_ListenerAcceleration;
+    bool m_HasListenerHistory;
+    // Center of the last tile requested by predictive streaming
+    FVector m_PredictedLoadCenter;
+
     FTransform m_LastSpaceTransform;
 
 #if !UE_BUILD_SHIPPING
@@ -5,12 +5,36 @@
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
 #include "Stats/Stats.h"
+#include "Containers/ArrayView.h"
 #include "AcousticsDesignParams.h"
 #include "AcousticsSpace.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAcousticsRuntime, Log, All);
 DECLARE_STATS_GROUP(TEXT("Project Acoustics"), STATGROUP_Acoustics, STATCAT_Advanced);
 
+// Inputs for one source in a batched acoustic query. See IAcoustics::SubmitQueryBatch
+struct FAcousticsQueryRequest
+{
+    // The object ID that the sound source is attached to
+    uint64_t SourceObjectId;
+    // The position of the sound source
+    FVector SourceLocation;
+    // The position of the listener/player/camera
+    FVector ListenerLocation;
+    // Per-source design tweaks, interpolation and dynamic opening settings, as passed to UpdateObjectParameters
+    AcousticsObjectParams ObjectParams;
+};
+
+// Output for one source in a batched acoustic query. See IAcoustics::CollectQueryBatch
+struct FAcousticsQueryResult
+{
+    // Whether the acoustic query for this source succeeded. If false, ObjectParams holds no new acoustic data and
+    // the caller should re-use the previous parameters for this source
+    bool Success;
+    // Acoustic parameters, with global design tweaks and outdoorness filled in the same way as UpdateObjectParameters
+    AcousticsObjectParams ObjectParams;
+};
+
 /**
  * The public interface to this module.  In most cases, this interface is only public to sibling modules
  * within this plugin.
@@ -59,7 +83,11 @@ public:
     virtual void UnloadAceFile(bool clearOldQueries) = 0;
 
     /**
-     * Register a new dynamic opening with acoustic system
+     * Register a new dynamic opening with acoustic system.
+     * Adding, removing and updating openings are all queued, and applied in the order they were made on the next
+     * PostTick, so they reach queries a frame or two later.
+     *
+     * @return False if the opening couldn't be queued. Failures in Triton itself are logged when applied.
      */
     virtual bool AddDynamicOpening(
         class UAcousticsDynamicOpening* opening, const FVector& center, const FVector& normal,
@@ -78,6 +106,15 @@ public:
     virtual bool
     UpdateDynamicOpening(class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) = 0;
 
+    /**
+     * The attenuation Triton last applied to a dynamic opening. Updates are applied in the background, and an update
+     * Triton rejects is dropped, so keep sending the attenuation until this reports it.
+     *
+     * @return False if no attenuation has been applied since the opening was added
+     */
+    virtual bool GetAppliedDynamicOpeningAttenuation(
+        class UAcousticsDynamicOpening* opening, float& outDryAttenuationDb, float& outWetAttenuationDb) const = 0;
+
     /**
      * Sets global design settings that are applied to all acoustic queries
      */
@@ -106,6 +143,30 @@ public:
         const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
         AcousticsObjectParams& parameters) = 0;
 
+    /**
+     * Submit acoustic queries for many sources at once. All queries run in the background as a few chunked work items
+     * and their results are written to a single contiguous array, to be picked up with CollectQueryBatch.
+     * This avoids the per-source locking and allocation of UpdateObjectParameters. Sources queried through this path
+     * do not need to call RegisterSourceObject.
+     *
+     * Only one batch may be in flight at a time. The request data is copied, so the caller's array can be reused.
+     *
+     * @param requests Per-source query inputs
+     *
+     * @return True if the batch was queued. False if the previous batch is still running or no ACE file is loaded.
+     */
+    virtual bool SubmitQueryBatch(TArrayView<const FAcousticsQueryRequest> requests) = 0;
+
+    /**
+     * Retrieve the results of the last batch submitted with SubmitQueryBatch. Results are in the same order as the
+     * submitted requests. Typical use is to collect last frame's batch, then submit this frame's.
+     *
+     * @param outResults Receives one result per submitted request. Must hold at least as many entries as were submitted
+     *
+     * @return True if results were written. False if the batch is still running or there is nothing to collect.
+     */
+    virtual bool CollectQueryBatch(TArrayView<FAcousticsQueryResult> outResults) = 0;
+
     /*
      * All sources need to register with their sourceId before they can start processing. This adds the source
      * to the internal map caching results.
@@ -151,6 +212,18 @@ public:
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) = 0;
 
+    /**
+     * Used with the probe memory budget. Marks the loaded regions around the listener as in use this frame, so
+     * regions the listener has left are unloaded first. Call once per tick, before PostTick
+     */
+    virtual void TouchLoadedRegions(const FVector& listenerLocation) = 0;
+
+    /**
+     * True while a probe memory budget (PA.ProbeBudgetMB) is in effect. Streaming should then load new tiles
+     * without unloading the probes outside them, and leave it to the budget to unload the least recently used ones
+     */
+    virtual bool IsProbeBudgetEnabled() const = 0;
+
     // Convert between a world position (UE coordinates) to Triton
     // Takes into account any active transformations of the AcousticsSpace actor
     virtual FVector TritonPositionToWorld(const FVector& vec) const = 0;
@@ -33,17 +33,103 @@ namespace AcousticsUtils
     }
 
     // Scale conversion
-    static inline float DbToAmplitude(float decibels)
+    static inline float DbToAmplitudeExact(float decibels)
     {
         return pow(10.0f, decibels / 20.0f);
     }
 
-    static inline float AmplitudeToDb(float amplitude)
+    static inline float AmplitudeToDbExact(float amplitude)
     {
         // protect against 0 amplitude which throws exception - clamp at -200dB
         return 10 * log10(amplitude * amplitude + 1e-20f);
     }
 
+    // Approximate 2^x, from the fractional part with a cubic and the whole part straight into the exponent bits.
+    // The cubic is exactly 1 at 0 and 2 at 1, so integer powers are exact and the result is continuous across them.
+    // Relative error is under 1.1e-4. x is clamped to [-126, 126]
+    static inline float FastExp2(float x)
+    {
+        x = FMath::Clamp(x, -126.0f, 126.0f);
+        const float whole = FMath::FloorToFloat(x);
+        const float f = x - whole;
+        const float mantissa = 1.0f + f * (0.69542444f + f * (0.22630723f + f * 0.07826833f));
+        const uint32 exponentBits = static_cast<uint32>(static_cast<int32>(whole) + 127) << 23;
+        float exponent;
+        FMemory::Memcpy(&exponent, &exponentBits, sizeof(float));
+        return mantissa * exponent;
+    }
+
+    // Approximate log2(x) for normal, positive x, from the exponent bits plus a quartic over the mantissa.
+    // The quartic is exactly 0 at 1 and 1 at 2, so powers of two are exact. Absolute error is under 1.5e-4
+    static inline float FastLog2(const float x)
+    {
+        uint32 bits;
+        FMemory::Memcpy(&bits, &x, sizeof(float));
+        const int32 exponent = static_cast<int32>((bits >> 23) & 0xff) - 127;
+        bits = (bits & 0x007fffff) | 0x3f800000;
+        float mantissa;
+        FMemory::Memcpy(&mantissa, &bits, sizeof(float));
+        const float t = mantissa - 1.0f;
+        return static_cast<float>(exponent) +
+               (t * (1.4379904f + t * (-0.67267746f + t * (0.31159627f + t * -0.07690924f))));
+    }
+
+    // The same conversions as the exact versions above, within 0.001 dB everywhere from -120 to +24 dB
+    static inline float DbToAmplitudeFast(const float decibels)
+    {
+        // log2(10) / 20
+        return FastExp2(decibels * 0.16609640f);
+    }
+
+    static inline float AmplitudeToDbFast(const float amplitude)
+    {
+        // 10 * log10(2)
+        return 3.0103000f * FastLog2(amplitude * amplitude + 1e-20f);
+    }
+
+// Define ACOUSTICS_FAST_DB_CONVERSION=0 to make DbToAmplitude and AmplitudeToDb use pow and log10
+#ifndef ACOUSTICS_FAST_DB_CONVERSION
+#define ACOUSTICS_FAST_DB_CONVERSION 1
+#endif
+
+    static inline float DbToAmplitude(float decibels)
+    {
+#if ACOUSTICS_FAST_DB_CONVERSION
+        return DbToAmplitudeFast(decibels);
+#else
+        return DbToAmplitudeExact(decibels);
+#endif
+    }
+
+    static inline float AmplitudeToDb(float amplitude)
+    {
+#if ACOUSTICS_FAST_DB_CONVERSION
+        return AmplitudeToDbFast(amplitude);
+#else
+        return AmplitudeToDbExact(amplitude);
+#endif
+    }
+
+    // Array versions. Input and output must be the same length, and may be the same array. With the fast conversions
+    // the loops are branch-free and call nothing, so the compiler can vectorize them
+    static inline void DbToAmplitude(TArrayView<const float> decibels, TArrayView<float> outAmplitudes)
+    {
+        check(decibels.Num() == outAmplitudes.Num());
+        for (int32 i = 0; i < decibels.Num(); i++)
+        {
+            outAmplitudes[i] = DbToAmplitude(decibels[i]);
+        }
+    }
+
+    static inline void AmplitudeToDb(TArrayView<const float> amplitudes, TArrayView<float> outDecibels)
+    {
+        check(amplitudes.Num() == outDecibels.Num());
+        for (int32 i = 0; i < amplitudes.Num(); i++)
+        {
+            outDecibels[i] = AmplitudeToDb(amplitudes[i]);
+        }
+    }
+
     // Conversion routines:
     //    Unreal's engine is left-handed Z-up, centimeters
     //    Unreal's FBX import & export is left-handed Z-up, centimeters
@@ -9,82 +9,18 @@
 #include "AcousticsDesignParams.h"
 #include "TritonDebugInterface.h"
 #include "Async/Async.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
 #include "MathUtils.h"
+#include "AcousticsQueryScheduler.h"
+#include "AcousticsResultSlot.h"
+#include "AcousticsQueryCache.h"
+#include "AcousticsProbeBudget.h"
 
 #if !UE_BUILD_SHIPPING
 class FProjectAcousticsDebugRender;
 #endif
 
-// A generic class that accepts a function to do work in Unreal's ThreadPool system.
-// Keeps track of when the task has finished its work or been abandoned. Up to the user
-// to signal when the task has been queued with m_IsQueuedOrRunning
-class FAcousticsQueuedWork : public IQueuedWork
-{
-public:
-    FAcousticsQueuedWork(TFunction<void()>&& inFunction, volatile int32* inDoneCounter)
-        : m_Function(inFunction), m_DoneCounter(inDoneCounter)
-    {
-    }
-
-    virtual void DoThreadedWork() override
-    {
-        m_Function();
-        SignalStop();
-    }
-
-    virtual void Abandon() override
-    {
-        SignalStop();
-    }
-
-    // Signal to the counters that this item has been queued or is running
-    void SignalStart()
-    {
-        FPlatformAtomics::AtomicStore(&m_IsQueuedOrRunning, 1);
-        FPlatformAtomics::InterlockedIncrement(m_DoneCounter);
-    }
-
-    // Signal to the counters that this item has finished, retracted, or abandoned
-    void SignalStop()
-    {
-        FPlatformAtomics::AtomicStore(&m_IsQueuedOrRunning, 0);
-        FPlatformAtomics::InterlockedDecrement(m_DoneCounter);
-    }
-
-    /** The function to execute on the Task Graph. */
-    TFunction<void()> m_Function;
-
-    // Keep track of when this task is running and not. User should set to 1
-    // when they queue this task
-    volatile int32 m_IsQueuedOrRunning = 0;
-
-    // For updating a caller's running task counter
-    volatile int32* m_DoneCounter;
-};
-
-// All the results from a Triton acoustics query
-struct AcousticQueryResults
-{
-    TritonAcousticParameters AcousticParams;
-    TritonDynamicOpeningInfo OpeningInfo;
-    TritonRuntime::QueryDebugInfo QueryDebugInfo;
-    // Whether the acoustic query was successful or not
-    bool QueryResult;
-};
-
-// Holds the data for a queued acoustics query
-struct AsyncAcousticQueryResults
-{
-    // Results from an acoustics query will be placed here when ready
-    TFuture<AcousticQueryResults> QueryResults;
-    // This is the queued work item. Saving this so we can retract it from the pool if needed
-    TUniquePtr<FAcousticsQueuedWork> QueuedWork;
-    // Whether or not this source has processed any frames so far
-    bool HasProcessed = false;
-    // Whether or not a retraction has been issued on this async query
-    bool RetractionRequested = false;
-};
-
 class FProjectAcousticsModule : public IAcoustics
 {
 public:
@@ -104,6 +40,9 @@ public:
     virtual bool RemoveDynamicOpening(class UAcousticsDynamicOpening* opening) override;
     virtual bool UpdateDynamicOpening(
         class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) override;
+    virtual bool GetAppliedDynamicOpeningAttenuation(
+        class UAcousticsDynamicOpening* opening, float& outDryAttenuationDb,
+        float& outWetAttenuationDb) const override;
 
     virtual bool SetGlobalDesign(const FAcousticsDesignParams& params) override;
     virtual void SetSpaceTransform(const FTransform& newTransform) override;
@@ -115,6 +54,9 @@ public:
         const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
         AcousticsObjectParams objectParams);
 
+    virtual bool SubmitQueryBatch(TArrayView<const FAcousticsQueryRequest> requests) override;
+    virtual bool CollectQueryBatch(TArrayView<FAcousticsQueryResult> outResults) override;
+
     virtual void RegisterSourceObject(const uint64_t sourceObjectId) override;
     virtual void UnregisterSourceObject(const uint64_t sourceObjectId) override;
 
@@ -131,6 +73,8 @@ public:
     virtual void UpdateLoadedRegion(
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) override;
+    virtual void TouchLoadedRegions(const FVector& listenerLocation) override;
+    virtual bool IsProbeBudgetEnabled() const override;
 
     virtual FVector TritonPositionToWorld(const FVector& vec) const override;
     virtual FVector WorldPositionToTriton(const FVector& vec) const override;
@@ -171,6 +115,16 @@ public:
         return m_TritonIOHook != nullptr ? m_TritonIOHook->GetBytesRead() : 0;
     }
 
+    int32 GetQueryQueueDepth() const
+    {
+        return m_QueryScheduler.GetQueueDepth();
+    }
+
+    int32 GetNumQueryWorkers() const
+    {
+        return m_QueryScheduler.GetNumWorkers();
+    }
+
 #endif
 
 private:
@@ -180,29 +134,123 @@ private:
     bool m_AceFileLoaded;
     FVector m_LastLoadCenterPosition;
     FVector m_LastLoadTileSize;
+    // Non-blocking load requested while streaming was still busy with an earlier one. Issued from PostTick once
+    // streaming is idle, unless a newer request replaces it first
+    struct FPendingLoad
+    {
+        FVector Center;
+        FVector TileSize;
+        bool UnloadOutsideTile;
+    };
+    TOptional<FPendingLoad> m_PendingLoad;
     TUniquePtr<TritonRuntime::FTritonMemHook> m_TritonMemHook;
     TUniquePtr<TritonRuntime::FTritonLogHook> m_TritonLogHook;
-    TUniquePtr<TritonRuntime::FTritonUnrealIOHook> m_TritonIOHook;
+    TUniquePtr<TritonRuntime::FTritonFileIOHook> m_TritonIOHook;
     TUniquePtr<TritonRuntime::FTritonAsyncTaskHook> m_TritonTaskHook;
-    bool m_IsOutdoornessStale;
-    float m_CachedOutdoorness;
+
+    // Outdoorness is computed on a query worker and published here. Read lock-free from any thread
+    std::atomic<float> m_CachedOutdoorness;
+    // Re-used work item that computes outdoorness at m_OutdoornessRequestLocation
+    TUniquePtr<FAcousticsQueuedWork> m_OutdoornessWork;
+    // Inputs for the queued outdoorness computation, in world and Triton space. Only written while the work is idle
+    FVector m_OutdoornessRequestLocation;
+    Triton::Vec3d m_OutdoornessTritonListener;
+    int32 m_OutdoornessRequestGeneration;
+    // Inputs of the last outdoorness computation that succeeded. Written by the work, read while it's idle
+    FVector m_OutdoornessListenerLocation;
+    int32 m_OutdoornessRegionGeneration;
+    bool m_HasOutdoorness;
+    // Bumped whenever the loaded probes, or how world positions map onto them, change
+    volatile int32 m_RegionGeneration;
     FAcousticsDesignParams m_GlobalDesign;
     FTransform m_SpaceTransform;
     FTransform m_InverseSpaceTransform;
 
-    // Holds all async acoustic queries for each source before they've been returned to the caller
-    // Key is the sourceID, value is the acoustic query results
-    TMap<uint64_t, AsyncAcousticQueryResults> m_AcousticQueryResultMap;
+    // Latest query results for every registered source, one slot per source. Slots are allocated on first
+    // registration and re-used after a source unregisters, so their addresses stay stable for background queries
+    TArray<TUniquePtr<FAcousticsResultSlot>> m_SourceSlots;
+    // Slots whose source has unregistered, available for re-use
+    TArray<int32> m_FreeSourceSlots;
+    // Key is the sourceID, value is the index of its slot
+    TMap<uint64_t, int32> m_SourceSlotIndices;
+    // Registration takes this for write. Updates only take it for read to find their slot, so they never wait on
+    // each other or on the background queries
+    FRWLock m_SourceSlotLock;
+
+    // Optional cache of recent query results, shared by all sources
+    FAcousticsQueryCache m_QueryCache;
+    // Streaming tasks completed as of the last cache invalidation
+    int32 m_LastCompletedLoadTasks;
+    // Last attenuation Triton applied to each dynamic opening, so the cache is only invalidated by real changes, and
+    // openings can tell when their updates have landed. Only m_OpeningUpdateWork writes it
+    TMap<uint64_t, FVector2f> m_OpeningAttenuations;
+    // A dynamic opening being added, removed or updated, waiting to be applied to Triton
+    struct FOpeningOp
+    {
+        enum class EType : uint8
+        {
+            Add,
+            Remove,
+            Update
+        };
+        EType Type;
+        uint64_t Id;
+        // For Add, in Triton space, and the opening's name to report if Triton rejects it
+        FName Name;
+        Triton::Vec3d Center;
+        Triton::Vec3f Normal;
+        TArray<Triton::Vec3f> Vertices;
+        // For Update, dry and wet attenuation in dB
+        FVector2f Attenuation;
+    };
+    // Opening changes since the last batch was applied, in the order they were made. Applied to Triton by
+    // m_OpeningUpdateWork on a query worker, so the game thread never waits on Triton for them
+    TArray<FOpeningOp> m_PendingOpeningOps;
+    // Index of each opening's queued Update, while it's that opening's last queued op. Further updates in the same
+    // batch overwrite it, so only the latest value is applied
+    TMap<uint64_t, int32> m_PendingOpeningUpdates;
+    TUniquePtr<FAcousticsQueuedWork> m_OpeningUpdateWork;
+    // Guards the two pending containers above, and writes to m_OpeningAttenuations and reads of it outside the work
+    mutable FCriticalSection m_OpeningLock;
+
+    // Loaded regions in least-recently-used order, for keeping probe memory under PA.ProbeBudgetMB
+    FAcousticsProbeBudget m_ProbeBudget;
+    // Streaming tasks completed, and the frame, when the last region was evicted. Nothing else is evicted until
+    // that unload has had a chance to finish
+    int32 m_EvictionCompletedTasks;
+    int32 m_EvictionFrame;
+    bool m_HasWarnedOverBudget;
+
+    // Owns the worker thread(s) running background acoustic queries. Queries are sharded across workers by source
+    FAcousticsQueryScheduler m_QueryScheduler;
+
+    // Batched queries. Requests and results are kept in contiguous arrays that are re-used from batch to batch
+    TArray<FAcousticsQueryRequest> m_BatchRequests;
+    TArray<AcousticQueryResults> m_BatchQueryResults;
+    // One re-usable work item per chunk of a batch
+    TArray<TUniquePtr<FAcousticsQueuedWork>> m_BatchWork;
+    int32 m_BatchChunkSize;
+    int32 m_NumBatchChunks;
+    bool m_HasBatchToCollect;
+    // Taken once per SubmitQueryBatch/CollectQueryBatch call, never by the background chunks
+    FCriticalSection m_QueryBatchLock;
+
+    // Keep track of how many background queries are queued or running
+    FAcousticsTaskCounter m_NumRunningTasks;
 
-    // Map for all access to m_AcousticQueryResultMap. This map can be accessed by the game/audio thread and the
-    // background thread responsible for doing acoustic queries
-    FCriticalSection m_AcousticQueryResultMapLock;
+    // Counts calls to PostTick. Used to pace per-source queries when the adaptive query rate is on
+    volatile int32 m_QueryFrame;
 
-    // Thread pool responsible for maintaining our own pool of thread(s) for running background acoustic queries
-    FQueuedThreadPool* m_ThreadPool;
+    // Queries deferred by the per-frame query budget, dispatched from PostTick in priority order
+    TArray<FAcousticsResultSlot*> m_PendingQueries;
+    // Taken briefly by updates adding to m_PendingQueries and by PostTick dispatching from it. Always taken after
+    // m_SourceSlotLock when both are needed
+    FCriticalSection m_PendingQueryLock;
 
-    // Keep track of how many background queries are queued or running
-    volatile int32 m_NumRunningTasks;
+    // Time spent in Triton queries since the last PostTick, and the running average cost of one query
+    volatile int64 m_QueryCycles;
+    volatile int32 m_QueryCount;
+    float m_AverageQueryMicroseconds;
 
 #if !UE_BUILD_SHIPPING
     bool m_IsEnabled;
@@ -213,6 +261,35 @@ private:
     bool GetAcousticParameters(
         const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
         TritonDynamicOpeningInfo& outOpeningInfo, const TritonRuntime::InterpolationConfig& radiationDir, TritonRuntime::QueryDebugInfo* outDebugInfo = nullptr);
+    bool FinalizeObjectParameters(
+        const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticQueryResults& queryResults, AcousticsObjectParams& objectParams);
+    FAcousticsResultSlot* FindSourceSlot(const uint64_t sourceObjectId);
+    bool RetractSourceQuery(FAcousticsResultSlot& slot);
+    void OnLoadedRegionChanged();
+    void LoadRegion(
+        const FVector& center, const FVector& tileSize, const bool unloadProbesOutsideTile,
+        const bool blockOnCompletion);
+    bool IsStreamingBusy() const;
+    void EnforceProbeBudget(const int32 frame);
+    bool MakeRoomForRegion(const int32 frame);
+#if ACOUSTICS_TRACK_MEMORY
+    void EvictRegion(const FVector& center, const FVector& size, const int32 frame);
+#endif
+    void ComputeOutdoorness();
+    void ApplyOpeningUpdates();
+    bool ShouldQuerySource(
+        const FAcousticsResultSlot& slot, const int32 frame, const FVector& sourceLocation,
+        const FVector& listenerLocation) const;
+    void DeferSourceQuery(
+        FAcousticsResultSlot& slot, const int32 frame, const uint64_t sourceObjectId, const FVector& sourceLocation,
+        const FVector& listenerLocation, const AcousticsObjectParams& objectParams);
+    void CancelPendingQuery(FAcousticsResultSlot& slot);
+    void DispatchPendingQueries(const int32 frame);
+    void SmoothQueryResults(
+        FAcousticsResultSlot& slot, const int32 frame, const bool isNewResult, AcousticQueryResults& inOutResults);
+    bool IsQueryBatchRunning() const;
+    void RunQueryBatchChunk(int32 chunkIndex);
     void WaitForRunningTasks();
 };
 
@@ -223,4 +300,10 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Acoustics"), STAT_Acoustics_Query, STATGRO
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Outdoorness"), STAT_Acoustics_QueryOutdoorness, STATGROUP_Acoustics, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Region"), STAT_Acoustics_LoadRegion, STATGROUP_Acoustics, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Ace File"), STAT_Acoustics_LoadAce, STATGROUP_Acoustics, );
-DECLARE_CYCLE_STAT_EXTERN(TEXT("Clear Ace File"), STAT_Acoustics_ClearAce, STATGROUP_Acoustics, );
\ No newline at end of file
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Clear Ace File"), STAT_Acoustics_ClearAce, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queries Skipped"), STAT_Acoustics_QueriesSkipped, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Dynamic Opening Updates"), STAT_Acoustics_OpeningUpdates, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Queries"), STAT_Acoustics_PendingQueries, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Average Query Cost (us)"), STAT_Acoustics_AverageQueryCost, STATGROUP_Acoustics, );
\ No newline at end of file
@@ -0,0 +1,55 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsReverbWeightTable.h"
+
+TSharedRef<const FAcousticsReverbWeightTable, ESPMode::ThreadSafe>
+FAcousticsReverbWeightTable::Build(const IAcoustics* acoustics, const TArray<float>& busDecayTimes)
+{
+    TSharedRef<FAcousticsReverbWeightTable, ESPMode::ThreadSafe> table =
+        MakeShared<FAcousticsReverbWeightTable, ESPMode::ThreadSafe>();
+    table->m_BusDecayTimes = busDecayTimes;
+    const int32 numBuses = busDecayTimes.Num();
+    // Decay times past twice the longest bus are rare, and are calculated exactly
+    table->m_MaxDecay = numBuses > 0 ? 2.0f * busDecayTimes.Last() : 0.0f;
+    if (acoustics == nullptr || table->m_MaxDecay <= 0.0f)
+    {
+        return table;
+    }
+
+    // The weights for each sample are stored together
+    table->m_SamplesPerSecond = (c_NumSamples - 1) / table->m_MaxDecay;
+    table->m_Weights.SetNumZeroed(c_NumSamples * numBuses);
+    for (int32 i = 0; i < c_NumSamples; i++)
+    {
+        acoustics->CalculateReverbSendWeights(
+            i / table->m_SamplesPerSecond, numBuses, busDecayTimes.GetData(), &table->m_Weights[i * numBuses]);
+    }
+    return table;
+}
+
+void FAcousticsReverbWeightTable::GetWeights(
+    const IAcoustics* acoustics, const float decayTime, float* outWeights) const
+{
+    const int32 numBuses = m_BusDecayTimes.Num();
+    if (m_Weights.Num() == 0 || decayTime >= m_MaxDecay)
+    {
+        if (acoustics == nullptr ||
+            !acoustics->CalculateReverbSendWeights(decayTime, numBuses, m_BusDecayTimes.GetData(), outWeights))
+        {
+            FMemory::Memzero(outWeights, numBuses * sizeof(float));
+        }
+        return;
+    }
+
+    // Linear between the two nearest samples. Each sample's weights sum to one, so the blend does too
+    const float position = FMath::Max(decayTime, 0.0f) * m_SamplesPerSecond;
+    const int32 sample = FMath::Min(FMath::FloorToInt32(position), c_NumSamples - 2);
+    const float alpha = position - sample;
+    const float* lower = &m_Weights[sample * numBuses];
+    const float* upper = lower + numBuses;
+    for (int32 i = 0; i < numBuses; i++)
+    {
+        outWeights[i] = FMath::Lerp(lower[i], upper[i], alpha);
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IAcoustics.h"
+
+// Reverb bus decay times, and the send weights sampled over decay time from 0 to MaxDecay, so each source's
+// weights can be interpolated instead of calculated.
+// Never modified once built, so the audio render thread can use it while the game thread builds the next.
+// Interpolated weights are within c_MaxError of CalculateReverbSendWeights for bus lengths spread like the default
+// preset's. Buses much closer together than the sample spacing make the kinks between them harder to follow
+class FAcousticsReverbWeightTable
+{
+public:
+    static constexpr int32 c_NumSamples = 256;
+    static constexpr float c_MaxError = 0.02f;
+
+    // Samples CalculateReverbSendWeights for the given bus decay times, which must be in increasing order
+    static TSharedRef<const FAcousticsReverbWeightTable, ESPMode::ThreadSafe>
+    Build(const IAcoustics* acoustics, const TArray<float>& busDecayTimes);
+
+    // Send weights for a decay time, one per bus. Decay times past the end of the table are calculated exactly
+    void GetWeights(const IAcoustics* acoustics, const float decayTime, float* outWeights) const;
+
+    int32 GetNumBuses() const
+    {
+        return m_BusDecayTimes.Num();
+    }
+
+    float GetMaxDecay() const
+    {
+        return m_MaxDecay;
+    }
+
+private:
+    TArray<float> m_BusDecayTimes;
+    TArray<float> m_Weights;
+    float m_MaxDecay = 0.0f;
+    float m_SamplesPerSecond = 0.0f;
+};
@@ -14,6 +14,7 @@
 #include "AcousticsParameterInterface.h"
 #include "AcousticsSourceBufferListener.h"
 #include "AcousticsAudioComponent.h"
+#include "AcousticsReverbWeightTable.h"
 #include "Engine/EngineTypes.h"
 #include "Components/AudioComponent.h"
 
@@ -27,6 +28,11 @@ FAcousticsSourceDataOverride::FAcousticsSourceDataOverride()
 {
 }
 
+FAcousticsSourceDataOverride::~FAcousticsSourceDataOverride()
+{
+    UAcousticsSourceDataOverrideSettings::OnSettingsChanged().Remove(m_SettingsChangedHandle);
+}
+
 // Initializes the source data override plugin
 void FAcousticsSourceDataOverride::Initialize(const FAudioPluginInitializationParams InitializationParams)
 {
@@ -48,6 +54,9 @@ void FAcousticsSourceDataOverride::Initialize(const FAudioPluginInitializationPa
 
     // Allocate settings for max sources
     m_SourceSettings.Init(nullptr, InitializationParams.NumSources);
+    m_SourceRecords.SetNum(InitializationParams.NumSources);
+    m_VolumeLookupCaches.SetNum(InitializationParams.NumSources);
+    m_MetaSoundParamStates.SetNum(InitializationParams.NumSources);
 
     // Process the reverb settings
     auto settings = GetDefault<UAcousticsSourceDataOverrideSettings>();
@@ -158,6 +167,80 @@ void FAcousticsSourceDataOverride::Initialize(const FAudioPluginInitializationPa
     m_LongOutdoorSubmixSend.SendStage = sendStage;
 
     m_IsStereoReverbInitialized = true;
+
+    // The weight table is built here and whenever the project settings change, both on the game thread, so the audio
+    // render thread only ever swaps in a finished table
+    RefreshProjectSettings();
+    UAcousticsSourceDataOverrideSettings::OnSettingsChanged().Remove(m_SettingsChangedHandle);
+    m_SettingsChangedHandle = UAcousticsSourceDataOverrideSettings::OnSettingsChanged().AddRaw(
+        this, &FAcousticsSourceDataOverride::RefreshProjectSettings);
+}
+
+void FAcousticsSourceDataOverride::RefreshProjectSettings()
+{
+    auto settings = GetDefault<UAcousticsSourceDataOverrideSettings>();
+    const TArray<float> busDecayTimes = {
+        settings->ShortReverbLength, settings->MediumReverbLength, settings->LongReverbLength};
+    if (busDecayTimes == m_BuiltReverbBusDecayTimes)
+    {
+        return;
+    }
+    m_BuiltReverbBusDecayTimes = busDecayTimes;
+
+    FReverbWeightTablePtr table = FAcousticsReverbWeightTable::Build(m_Acoustics, busDecayTimes);
+    {
+        FScopeLock lock(&m_PendingReverbWeightsLock);
+        m_PendingReverbWeights = MoveTemp(table);
+    }
+    FPlatformAtomics::InterlockedExchange(&m_HasPendingReverbWeights, 1);
+}
+
+void FAcousticsSourceDataOverride::GetReverbSendWeights(const float decayTime, float* outWeights) const
+{
+    const FAcousticsReverbWeightTable* table = m_ReverbWeights.Get();
+    if (table == nullptr)
+    {
+        FMemory::Memzero(outWeights, m_ReverbBusWeights.Num() * sizeof(float));
+        return;
+    }
+    table->GetWeights(m_Acoustics, decayTime, outWeights);
+}
+
+const FAcousticsSourceDataOverride::FSourceRecord& FAcousticsSourceDataOverride::GetSourceRecord(
+    const uint32 SourceId, const FWaveInstance* InOutWaveInstance)
+{
+    FSourceRecord& record = m_SourceRecords[SourceId];
+    const uint64 audioComponentId = InOutWaveInstance->ActiveSound->GetAudioComponentID();
+    if (record.IsResolved && record.AudioComponentId == audioComponentId)
+    {
+        return record;
+    }
+
+    record.IsResolved = true;
+    record.AudioComponentId = audioComponentId;
+
+    // Check if this source's audio component is our PA specific component
+    auto audioComponent = UAudioComponent::GetAudioComponentFromID(audioComponentId);
+    record.AcousticsComponent = Cast<UAcousticsAudioComponent>(audioComponent);
+
+    const USoundBase* sound = InOutWaveInstance->ActiveSound->GetSound();
+    record.IsMetaSound =
+        sound != nullptr && sound->ImplementsParameterInterface(AcousticsParameterInterface::GetInterface());
+
+    return record;
+}
+
+const FAcousticsSourceSettings* FAcousticsSourceDataOverride::GetSourceSettings(
+    const uint32 SourceId, const FSourceRecord& record) const
+{
+    // The acoustics audio component's settings take precedence over the shared per-source settings
+    if (const UAcousticsAudioComponent* aac = record.AcousticsComponent.Get())
+    {
+        return &aac->Settings;
+    }
+
+    auto sourceSettings = m_SourceSettings[SourceId];
+    return sourceSettings != nullptr ? &sourceSettings->Settings : nullptr;
 }
 
 // Called when a source is assigned to a voice.
@@ -181,6 +264,9 @@ void FAcousticsSourceDataOverride::OnInitSource(
         m_SpatialReverb->OnInitSource(SourceId, AudioComponentUserId, InSettings);
     }
 
+    m_SourceRecords[SourceId] = FSourceRecord();
+    m_VolumeLookupCaches[SourceId].Reset();
+    m_MetaSoundParamStates[SourceId] = FMetaSoundParamState();
     m_Acoustics->RegisterSourceObject(SourceId);
 
 #if !UE_BUILD_SHIPPING
@@ -218,35 +304,12 @@ void FAcousticsSourceDataOverride::OnReleaseSource(const uint32 SourceId)
 }
 
 void FAcousticsSourceDataOverride::ApplyAcousticsDesignParamsOverrides(
-    UWorld* world, FVector sourceLocation, FAcousticsDesignParams& designParams)
+    const uint32 SourceId, UWorld* world, const FVector& sourceLocation, FAcousticsDesignParams& designParams)
 {
     if (world)
     {
-        TArray<FOverlapResult> OverlapResults;
-        FCollisionQueryParams Params(SCENE_QUERY_STAT(AddForceOverlap), false);
-
-        if (world->OverlapMultiByObjectType(
-                OverlapResults,
-                sourceLocation,
-                FQuat::Identity,
-                FCollisionObjectQueryParams(ECC_WorldStatic),
-                FCollisionShape::MakeSphere(0.0f),
-                Params))
-        {
-            for (const FOverlapResult& OverlapResult : OverlapResults)
-            {
-                AAcousticsRuntimeVolume* AcousticsRuntimeVolume =
-                    Cast<AAcousticsRuntimeVolume>(OverlapResult.GetActor());
-
-                if (AcousticsRuntimeVolume != nullptr)
-                {
-                    auto overrideParams = AcousticsRuntimeVolume->OverrideDesignParams;
-
-                    // Apply the override parameters and save to the object's design params
-                    FAcousticsDesignParams::Combine(designParams, overrideParams);
-                }
-            }
-        }
+        FAcousticsRuntimeVolumeIndex::Get().ApplyOverrides(
+            world, sourceLocation, m_VolumeLookupCaches[SourceId], designParams);
     }
 }
 
@@ -286,47 +349,20 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
     auto sourceLocation = InOutWaveInstance->Location;
     auto listenerLocation = InListenerTransform.GetLocation();
 
-    // Save the shared per-source settings if there are any
-    auto sourceSettings = m_SourceSettings[SourceId];
-    if (sourceSettings != nullptr)
-    {
-        objectParams.Design = sourceSettings->Settings.DesignParams;
-        enablePortaling = sourceSettings->Settings.EnablePortaling;
-        enableOcclusion = sourceSettings->Settings.EnableOcclusion;
-        enableReverb = sourceSettings->Settings.EnableReverb;
-        showAcousticParameters = sourceSettings->Settings.ShowAcousticParameters;
-        applyAcousticsVolumes = sourceSettings->Settings.ApplyAcousticsVolumes;
-        objectParams.InterpolationConfig = TritonRuntime::InterpolationConfig(
-            static_cast<TritonRuntime::InterpolationConfig::DisambiguationMode>(sourceSettings->Settings.Resolver),
-            AcousticsUtils::ToTritonVector(
-                m_Acoustics->WorldDirectionToTriton(sourceSettings->Settings.PushDirection)));
-        objectParams.ApplyDynamicOpenings = sourceSettings->Settings.ApplyDynamicOpenings;
-    }
-
-    // Grab the audio component belonging to this sound source
-    auto audioComponentId = InOutWaveInstance->ActiveSound->GetAudioComponentID();
-    auto audioComponent = UAudioComponent::GetAudioComponentFromID(audioComponentId);
-    UAcousticsAudioComponent* aac = nullptr;
-
-    // Now check if this audio component is our PA specific component. If so, grab those settings too
-    if (audioComponent != nullptr && audioComponent->IsA<UAcousticsAudioComponent>())
+    // Use the source's settings if there are any
+    const FSourceRecord& record = GetSourceRecord(SourceId, InOutWaveInstance);
+    if (const FAcousticsSourceSettings* settings = GetSourceSettings(SourceId, record))
     {
-        aac = Cast<UAcousticsAudioComponent>(audioComponent);
-        if (aac != nullptr)
-        {
-            // Audio Component params take precedence. Overwrite all settings with the ones from
-            // the AcousticsAudioComponent
-            objectParams.Design = aac->Settings.DesignParams;
-            enablePortaling = aac->Settings.EnablePortaling;
-            enableOcclusion = aac->Settings.EnableOcclusion;
-            enableReverb = aac->Settings.EnableReverb;
-            showAcousticParameters = aac->Settings.ShowAcousticParameters;
-            applyAcousticsVolumes = aac->Settings.ApplyAcousticsVolumes;
-            objectParams.InterpolationConfig = TritonRuntime::InterpolationConfig(
-                static_cast<TritonRuntime::InterpolationConfig::DisambiguationMode>(aac->Settings.Resolver),
-                AcousticsUtils::ToTritonVector(m_Acoustics->WorldDirectionToTriton(aac->Settings.PushDirection)));
-            objectParams.ApplyDynamicOpenings = aac->Settings.ApplyDynamicOpenings;
-        }
+        objectParams.Design = settings->DesignParams;
+        enablePortaling = settings->EnablePortaling;
+        enableOcclusion = settings->EnableOcclusion;
+        enableReverb = settings->EnableReverb;
+        showAcousticParameters = settings->ShowAcousticParameters;
+        applyAcousticsVolumes = settings->ApplyAcousticsVolumes;
+        objectParams.InterpolationConfig = TritonRuntime::InterpolationConfig(
+            static_cast<TritonRuntime::InterpolationConfig::DisambiguationMode>(settings->Resolver),
+            AcousticsUtils::ToTritonVector(m_Acoustics->WorldDirectionToTriton(settings->PushDirection)));
+        objectParams.ApplyDynamicOpenings = settings->ApplyDynamicOpenings;
     }
 
     if (objectParams.ApplyDynamicOpenings)
@@ -337,7 +373,7 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
     if (applyAcousticsVolumes)
     {
         ApplyAcousticsDesignParamsOverrides(
-            InOutWaveInstance->ActiveSound->GetWorld(), sourceLocation, objectParams.Design);
+            SourceId, InOutWaveInstance->ActiveSound->GetWorld(), sourceLocation, objectParams.Design);
     }
 
     // Run the acoustic query
@@ -373,11 +409,6 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
 
     auto acousticParams = objectParams.TritonParams;
 
-    Audio::FParameterInterfacePtr paInterface = AcousticsParameterInterface::GetInterface();
-    TArray<FAudioParameter> paramsToUpdate;
-    // See if the current sound is a MetaSound
-    const bool isMetaSound = InOutWaveInstance->ActiveSound->GetSound()->ImplementsParameterInterface(paInterface);
-
     // Arrival direction for dry sound, including geometry
     FVector portalDir =
         m_Acoustics->TritonDirectionToWorld(AcousticsUtils::ToFVector(acousticParams.Dry.ArrivalDirection));
@@ -434,41 +465,100 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
             InOutWaveInstance);
     }
 
-    if (isMetaSound)
+    if (record.IsMetaSound)
     {
-        // Store the rest of the acoustic parameters for the MetaSound parameter update
-
-        // Get dry azimuth and elevation
+        // Get dry and wet azimuth and elevation
         float dryAzimuth = 0.0f, dryElevation = 0.0f;
         GetMetaSoundAzimuthAndElevation(InListenerTransform, portalDir, dryAzimuth, dryElevation);
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::DryArrivalAzimuth, dryAzimuth});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::DryArrivalElevation, dryElevation});
-
-        // Get wet azimuth and elevation
         float wetAzimuth = 0.0f, wetElevation = 0.0f;
         FVector reverbDir =
             m_Acoustics->TritonDirectionToWorld(AcousticsUtils::ToFVector(acousticParams.Wet.ArrivalDirection));
         GetMetaSoundAzimuthAndElevation(InListenerTransform, reverbDir, wetAzimuth, wetElevation);
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetArrivalAzimuth, wetAzimuth});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetArrivalElevation, wetElevation});
-
-        // Store the rest of the acoustic parameters
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::DryLoudness, acousticParams.Dry.LoudnessDb});
-        paramsToUpdate.Add(
-            {AcousticsParameterInterface::Inputs::DryPathLength,
-             AcousticsUtils::TritonValToUnreal(acousticParams.Dry.PathLengthMeters)});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetLoudness, acousticParams.Wet.LoudnessDb});
-        paramsToUpdate.Add(
-            {AcousticsParameterInterface::Inputs::WetAngularSpread, acousticParams.Wet.AngularSpreadDegrees});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetDecayTime, acousticParams.Wet.DecayTimeSeconds});
-
-        // Send the parameters to the MetaSound interface
-        auto paramTransmitter = InOutWaveInstance->ActiveSound->GetTransmitter();
-        if (paramTransmitter != nullptr)
+
+        // In the same order as the table in SendMetaSoundParameters
+        const float values[FMetaSoundParamState::NumParams] = {
+            dryAzimuth,
+            dryElevation,
+            wetAzimuth,
+            wetElevation,
+            acousticParams.Dry.LoudnessDb,
+            AcousticsUtils::TritonValToUnreal(acousticParams.Dry.PathLengthMeters),
+            acousticParams.Wet.LoudnessDb,
+            acousticParams.Wet.AngularSpreadDegrees,
+            acousticParams.Wet.DecayTimeSeconds};
+        SendMetaSoundParameters(SourceId, values, InOutWaveInstance);
+    }
+}
+
+void FAcousticsSourceDataOverride::SendMetaSoundParameters(
+    const uint32 SourceId, const float (&values)[FMetaSoundParamState::NumParams], FWaveInstance* InOutWaveInstance)
+{
+    // Every parameter is sent at least this often, in case the MetaSound missed or reset a value
+    constexpr int32 c_MetaSoundRefreshInterval = 30;
+
+    struct FParamInfo
+    {
+        const FName& Name;
+        // Changes smaller than this aren't sent
+        float Epsilon;
+        // Azimuths wrap around at 360 degrees
+        bool IsAzimuth;
+    };
+    static const FParamInfo c_Params[FMetaSoundParamState::NumParams] = {
+        {AcousticsParameterInterface::Inputs::DryArrivalAzimuth, 0.5f, true},
+        {AcousticsParameterInterface::Inputs::DryArrivalElevation, 0.5f, false},
+        {AcousticsParameterInterface::Inputs::WetArrivalAzimuth, 0.5f, true},
+        {AcousticsParameterInterface::Inputs::WetArrivalElevation, 0.5f, false},
+        {AcousticsParameterInterface::Inputs::DryLoudness, 0.1f, false},
+        // In cm
+        {AcousticsParameterInterface::Inputs::DryPathLength, 5.0f, false},
+        {AcousticsParameterInterface::Inputs::WetLoudness, 0.1f, false},
+        {AcousticsParameterInterface::Inputs::WetAngularSpread, 0.5f, false},
+        // In seconds
+        {AcousticsParameterInterface::Inputs::WetDecayTime, 0.01f, false}};
+
+    auto paramTransmitter = InOutWaveInstance->ActiveSound->GetTransmitter();
+    if (paramTransmitter == nullptr)
+    {
+        return;
+    }
+
+    FMetaSoundParamState& state = m_MetaSoundParamStates[SourceId];
+    const bool refreshAll = !state.HasSent || ++state.UpdatesSinceRefresh >= c_MetaSoundRefreshInterval;
+
+    uint32 changedMask = 0;
+    for (int32 i = 0; i < FMetaSoundParamState::NumParams; i++)
+    {
+        const float delta = c_Params[i].IsAzimuth ? FMath::FindDeltaAngleDegrees(state.LastSent[i], values[i])
+                                                  : values[i] - state.LastSent[i];
+        if (refreshAll || FMath::Abs(delta) > c_Params[i].Epsilon)
         {
-            paramTransmitter->SetParameters(MoveTemp(paramsToUpdate));
+            changedMask |= 1u << i;
         }
     }
+    if (changedMask == 0)
+    {
+        return;
+    }
+
+    // The transmitter takes ownership of the array, so it can't be re-used. Size it once up front instead
+    TArray<FAudioParameter> paramsToUpdate;
+    paramsToUpdate.Reserve(FMath::CountBits(changedMask));
+    for (int32 i = 0; i < FMetaSoundParamState::NumParams; i++)
+    {
+        if (changedMask & (1u << i))
+        {
+            paramsToUpdate.Add({c_Params[i].Name, values[i]});
+            state.LastSent[i] = values[i];
+        }
+    }
+    paramTransmitter->SetParameters(MoveTemp(paramsToUpdate));
+
+    state.HasSent = true;
+    if (refreshAll)
+    {
+        state.UpdatesSinceRefresh = 0;
+    }
 }
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
@@ -575,17 +665,18 @@ void FAcousticsSourceDataOverride::ProcessReverb(
     // For rendering the stereo reverb with our bank of convolution reverbs
     else if (m_ReverbType == EAcousticsReverbType::StereoConvolution && m_IsStereoReverbInitialized)
     {
-        auto settings = GetDefault<UAcousticsSourceDataOverrideSettings>();
+        // Swap in a table rebuilt for new project settings. Building it is left to the game thread
+        if (FPlatformAtomics::InterlockedExchange(&m_HasPendingReverbWeights, 0) != 0)
+        {
+            FScopeLock lock(&m_PendingReverbWeightsLock);
+            if (m_PendingReverbWeights.IsValid())
+            {
+                m_ReverbWeights = MoveTemp(m_PendingReverbWeights);
+            }
+        }
 
         // Calulate the reverb bus weights based on the Triton reverb time
-        m_ReverbBusDecayTimes[0] = settings->ShortReverbLength;
-        m_ReverbBusDecayTimes[1] = settings->MediumReverbLength;
-        m_ReverbBusDecayTimes[2] = settings->LongReverbLength;
-        m_Acoustics->CalculateReverbSendWeights(
-            wetDecayTimeDesigned,
-            m_ReverbBusDecayTimes.Num(),
-            m_ReverbBusDecayTimes.GetData(),
-            m_ReverbBusWeights.GetData());
+        GetReverbSendWeights(wetDecayTimeDesigned, m_ReverbBusWeights.GetData());
 
         // Mix the gain between outdoor and indoor, apply a gain boost to match loudness of spatial reverb.
         constexpr float stereoReverbGainBoost = 2.8f;
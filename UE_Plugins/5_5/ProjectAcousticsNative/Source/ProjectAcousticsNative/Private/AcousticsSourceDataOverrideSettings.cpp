@@ -6,6 +6,8 @@
 
 //DEFINE_LOG_CATEGORY(LogAcousticsNative)
 
+FSimpleMulticastDelegate UAcousticsSourceDataOverrideSettings::s_OnSettingsChanged;
+
 UAcousticsSourceDataOverrideSettings::UAcousticsSourceDataOverrideSettings() :
     ReverbBusesPreset(EReverbBusesPreset::Default)
 {
@@ -43,6 +45,12 @@ UAcousticsSourceDataOverrideSettings::UAcousticsSourceDataOverrideSettings() :
 
 }
 
+void UAcousticsSourceDataOverrideSettings::NotifySettingsChanged()
+{
+    check(IsInGameThread());
+    s_OnSettingsChanged.Broadcast();
+}
+
 void UAcousticsSourceDataOverrideSettings::SetReverbBuses(FReverbBusesInfo buses)
 {
     ShortIndoorReverbSubmix = buses.ShortIndoorReverbSubmixName;
@@ -74,7 +82,6 @@ void UAcousticsSourceDataOverrideSettings::PostEditChangeProperty(FPropertyChang
                 Error,
                 TEXT("Project Acoustics SDO Spatial Reverb is not supported below UE 5.1. "
                     "Please change the ReverbType in the Project Acoustics SDO Project Settings"));
-            return;
         }
     }
     else if ((PropertyName == GET_MEMBER_NAME_CHECKED(UAcousticsSourceDataOverrideSettings, ReverbBusesPreset)))
@@ -168,6 +175,9 @@ void UAcousticsSourceDataOverrideSettings::PostEditChangeProperty(FPropertyChang
             UpdateSinglePropertyInConfigFile(Property, GetDefaultConfigFilename());
         }
     }
+
+    // Last, once a preset has written its reverb lengths, so sources never pick up a half-applied change
+    NotifySettingsChanged();
 }
 
 bool UAcousticsSourceDataOverrideSettings::CanEditChange(const FProperty* InProperty) const
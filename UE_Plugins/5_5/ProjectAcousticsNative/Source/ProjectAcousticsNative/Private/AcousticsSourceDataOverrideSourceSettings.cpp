@@ -24,4 +24,4 @@ bool UAcousticsSourceDataOverrideSourceSettings::CanEditChange(const FProperty*
 
     return ParentVal;
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,75 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "AcousticsReverbWeightTable.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsReverbWeightTableErrorTest, "ProjectAcoustics.ReverbWeightTable.ErrorBound",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsReverbWeightTableErrorTest::RunTest(const FString& Parameters)
+{
+    const IAcoustics* acoustics = &IAcoustics::Get();
+
+    // The default bus preset, and a longer custom one
+    const TArray<TArray<float>> presets = {{0.5f, 1.5f, 3.0f}, {1.0f, 2.5f, 5.0f}};
+    for (const TArray<float>& busDecayTimes : presets)
+    {
+        const auto table = FAcousticsReverbWeightTable::Build(acoustics, busDecayTimes);
+        TestEqual(TEXT("Max decay"), table->GetMaxDecay(), 2.0f * busDecayTimes.Last());
+
+        float maxError = 0.0f;
+        float worstDecay = 0.0f;
+        // Off the sample points, and on past the end of the table where weights are calculated exactly
+        constexpr int32 numSteps = 10007;
+        const float endDecay = 1.25f * table->GetMaxDecay();
+        for (int32 step = 0; step <= numSteps; step++)
+        {
+            const float decayTime = endDecay * step / numSteps;
+            float expected[3];
+            float actual[3];
+            if (!acoustics->CalculateReverbSendWeights(decayTime, 3, busDecayTimes.GetData(), expected))
+            {
+                continue;
+            }
+            table->GetWeights(acoustics, decayTime, actual);
+
+            float sum = 0.0f;
+            float expectedSum = 0.0f;
+            for (int32 bus = 0; bus < 3; bus++)
+            {
+                const float error = FMath::Abs(actual[bus] - expected[bus]);
+                if (error > maxError)
+                {
+                    maxError = error;
+                    worstDecay = decayTime;
+                }
+                sum += actual[bus];
+                expectedSum += expected[bus];
+            }
+            // Blending samples must not make the reverb louder or quieter overall
+            if (!FMath::IsNearlyEqual(sum, expectedSum, 1e-3f))
+            {
+                AddError(FString::Printf(
+                    TEXT("Weights for decay time %f sum to %f, not %f"), decayTime, sum, expectedSum));
+                return false;
+            }
+        }
+
+        AddInfo(FString::Printf(TEXT("Max weight error %g at decay time %f"), maxError, worstDecay));
+        TestTrue(TEXT("Interpolated weights are within the table's error bound"),
+            maxError <= FAcousticsReverbWeightTable::c_MaxError);
+    }
+
+    // Without any bus lengths there is nothing to sample, so every weight is calculated
+    const auto emptyTable = FAcousticsReverbWeightTable::Build(acoustics, {0.0f, 0.0f, 0.0f});
+    float weights[3] = {1.0f, 1.0f, 1.0f};
+    emptyTable->GetWeights(nullptr, 1.0f, weights);
+    TestEqual(TEXT("No table and no calculation gives no reverb"), weights[0] + weights[1] + weights[2], 0.0f);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -8,15 +8,19 @@
 #include "IAcoustics.h"
 #include "AcousticsSpatialReverb.h"
 #include "AcousticsSourceDataOverrideSourceSettings.h"
-#include "Engine/OverlapResult.h"
+#include "AcousticsRuntimeVolumeIndex.h"
 #include "AcousticsSourceDataOverrideSettings.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAcousticsNative, Log, All);
 
+class UAcousticsAudioComponent;
+class FAcousticsReverbWeightTable;
+
 class FAcousticsSourceDataOverride : public IAudioSourceDataOverride
 {
 public:
     FAcousticsSourceDataOverride();
+    virtual ~FAcousticsSourceDataOverride();
 
     // SourceDataOverride overrides
     virtual void Initialize(const FAudioPluginInitializationParams InitializationParams);
@@ -45,8 +49,45 @@ public:
     }
 
 private:
-    void
-    ApplyAcousticsDesignParamsOverrides(UWorld* world, FVector listenerLocation, FAcousticsDesignParams& designParams);
+    // What a source's settings come from. Resolved when the source first updates and kept until its audio component
+    // changes, so updates don't have to look the audio component up. The settings themselves are read on every
+    // update, as they can be changed from Blueprint at any time
+    struct FSourceRecord
+    {
+        // The source's acoustics audio component, whose settings take precedence over its settings asset. Unset if
+        // the audio component isn't one
+        TWeakObjectPtr<const UAcousticsAudioComponent> AcousticsComponent;
+        bool IsResolved = false;
+        uint64 AudioComponentId = 0;
+        // Whether the source's sound implements the acoustics MetaSound parameter interface
+        bool IsMetaSound = false;
+    };
+
+    // MetaSound parameters last sent for a source. A parameter is only sent again once it has moved further than
+    // its epsilon, or when every parameter is refreshed every few updates
+    struct FMetaSoundParamState
+    {
+        static constexpr int32 NumParams = 9;
+        float LastSent[NumParams] = {};
+        int32 UpdatesSinceRefresh = 0;
+        bool HasSent = false;
+    };
+
+    void SendMetaSoundParameters(
+        const uint32 SourceId, const float (&values)[FMetaSoundParamState::NumParams],
+        FWaveInstance* InOutWaveInstance);
+
+    const FSourceRecord& GetSourceRecord(const uint32 SourceId, const FWaveInstance* InOutWaveInstance);
+    // The settings currently set for a source, or null if it has neither an acoustics audio component nor a settings
+    // asset, so defaults apply
+    const FAcousticsSourceSettings* GetSourceSettings(const uint32 SourceId, const FSourceRecord& record) const;
+    using FReverbWeightTablePtr = TSharedPtr<const FAcousticsReverbWeightTable, ESPMode::ThreadSafe>;
+
+    void RefreshProjectSettings();
+    void GetReverbSendWeights(const float decayTime, float* outWeights) const;
+
+    void ApplyAcousticsDesignParamsOverrides(
+        const uint32 SourceId, UWorld* world, const FVector& sourceLocation, FAcousticsDesignParams& designParams);
     void ProcessReverb(
         const uint32 SourceId, const bool enablePortaling, const FVector& listenerLocation,
         const float occlusionDbDesigned, const float occlusionDbActual, const AcousticsObjectParams& objectParams,
@@ -76,6 +117,15 @@ private:
     // Source settings for all possible sources
     TArray<UAcousticsSourceDataOverrideSourceSettings*> m_SourceSettings;
 
+    // Resolved settings for all possible sources
+    TArray<FSourceRecord> m_SourceRecords;
+
+    // MetaSound parameters last sent for all possible sources
+    TArray<FMetaSoundParamState> m_MetaSoundParamStates;
+
+    // Runtime volumes found around each source at its last lookup
+    TArray<FAcousticsVolumeLookupCache> m_VolumeLookupCaches;
+
     // Whether or not stereo convolution reverb was successfully loaded
     bool m_IsStereoReverbInitialized = false;
 
@@ -84,7 +134,16 @@ private:
 
     // Arrays for calculating per-source reverb weights
     TArray<float> m_ReverbBusWeights = {0.0, 0.0, 0.0};
-    TArray<float> m_ReverbBusDecayTimes = {0.0, 0.0, 0.0};
+
+    // Reverb weight table used by the audio render thread
+    FReverbWeightTablePtr m_ReverbWeights;
+    // Table built on the game thread since the audio render thread last looked, waiting to replace m_ReverbWeights
+    FReverbWeightTablePtr m_PendingReverbWeights;
+    FCriticalSection m_PendingReverbWeightsLock;
+    volatile int32 m_HasPendingReverbWeights = 0;
+    // Bus decay times the last table was built for. Game thread only
+    TArray<float> m_BuiltReverbBusDecayTimes;
+    FDelegateHandle m_SettingsChangedHandle;
 
     // Which type of reverb we're using
     EAcousticsReverbType m_ReverbType = c_DefaultAcousticsReverbType;
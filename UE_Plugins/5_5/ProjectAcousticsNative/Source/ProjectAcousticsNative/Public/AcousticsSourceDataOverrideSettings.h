@@ -3,6 +3,7 @@
 
 #pragma once
 #include "Runtime/Launch/Resources/Version.h"
+#include "Delegates/Delegate.h"
 #include "AcousticsSourceDataOverrideSettings.generated.h"
 
 UENUM(BlueprintType)
@@ -75,6 +76,17 @@ public:
     virtual void PostInitProperties() override;
 #endif
 
+    // Playing sources only read the reverb bus lengths when they change. Call this after changing them at runtime,
+    // so playing sources pick the change up. Changes made in the editor do this automatically. Game thread only
+    UFUNCTION(BlueprintCallable, Category = "Acoustics")
+    static void NotifySettingsChanged();
+
+    // Broadcast on the game thread by NotifySettingsChanged
+    static FSimpleMulticastDelegate& OnSettingsChanged()
+    {
+        return s_OnSettingsChanged;
+    }
+
     /**
      *    Type of reverb to be rendered by Project Acoustics
      */
@@ -178,6 +190,8 @@ public:
 private:
     void SetReverbBuses(FReverbBusesInfo buses);
 
+    static FSimpleMulticastDelegate s_OnSettingsChanged;
+
     /**
      * Duplicate of the ShortIndoorReverbSubmix property. Used to store the last assigned custom submix
      */
@@ -0,0 +1,759 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Replays an ACE IO trace, recorded in-engine with PA.AceIOTrace, against its ACE file, and reports throughput,
+// IOPS and latency histograms for the replay next to the recorded timings.
+//
+// Standalone and headless: needs no engine, just a C++17 compiler on Linux or another POSIX system.
+//   g++ -std=c++17 -O2 -o AceIOTraceReplay AceIOTraceReplay.cpp
+//
+// Usage: AceIOTraceReplay <trace file> [options]
+//   --ace <file>          ACE file to read. Defaults to the path recorded in the trace
+//   --io <pread|mmap>     Read with pread through a block cache, like the plugin's default IO hook (default), or
+//                         copy out of a memory-mapped file, like PA.AceIOMode 1
+//   --cache-size <bytes>  pread block cache size. 0 reads straight from the file. Default 4M, the plugin's default
+//   --read-ahead <bytes>  Once reads run sequentially, ask the OS to start reading this far past each read.
+//                         0 disables read-ahead. Default 0
+//   --paced               Keep the recorded gaps between calls, rather than issuing them back to back
+//   --drop-cache          Ask the OS to drop the ACE file's cached pages first, so reads come from disk. Only
+//                         clean pages can be dropped, and some filesystems ignore the request
+//   --repeat <n>          Replay the trace this many times, reporting each pass. Default 1
+// Sizes take an optional K, M or G suffix.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Must match FTritonRecordingIOHook in UnrealTritonHooks.cpp. All fields are little-endian and unpadded
+    constexpr uint32_t c_IOTraceMagic = 0x4F494150; // 'PAIO'
+    constexpr uint32_t c_IOTraceVersion = 1;
+
+    enum class EOp : uint8_t
+    {
+        OpenForRead = 0,
+        Read = 1,
+        Seek = 2,
+        Close = 3
+    };
+    constexpr int c_NumOps = 4;
+    const char* const c_OpNames[c_NumOps] = {"OpenForRead", "Read", "Seek", "Close"};
+
+    struct FTraceRecord
+    {
+        EOp Op;
+        // Microseconds since the previous record started
+        uint32_t SinceLastUs;
+        // Microseconds the call took when recorded
+        uint32_t DurationUs;
+        // File position before the call. For Seek, the position sought to
+        uint64_t Position;
+        // Bytes requested by a Read
+        uint32_t Size;
+        // Bytes read for Read, otherwise 1 if the call succeeded
+        uint32_t Outcome;
+    };
+
+    struct FTrace
+    {
+        int64_t FileSize = 0;
+        std::string FileName;
+        std::vector<FTraceRecord> Records;
+        bool IsTruncated = false;
+    };
+
+    struct FOptions
+    {
+        std::string TraceFileName;
+        std::string AceFileName;
+        bool UseMappedIO = false;
+        uint64_t CacheSize = 4 * 1024 * 1024;
+        uint64_t ReadAheadSize = 0;
+        bool IsPaced = false;
+        bool DropCache = false;
+        int Repeat = 1;
+    };
+
+    using FClock = std::chrono::steady_clock;
+
+    double SecondsSince(FClock::time_point start)
+    {
+        return std::chrono::duration<double>(FClock::now() - start).count();
+    }
+
+    template <typename T>
+    bool ReadValue(FILE* file, T& value)
+    {
+        return fread(&value, sizeof(T), 1, file) == 1;
+    }
+
+    bool LoadTrace(const std::string& fileName, FTrace& outTrace)
+    {
+        static_assert(
+            sizeof(uint32_t) == 4 && sizeof(uint64_t) == 8, "Trace fields are read straight into fixed-width types");
+
+        FILE* file = fopen(fileName.c_str(), "rb");
+        if (file == nullptr)
+        {
+            fprintf(stderr, "Failed to open ACE IO trace: [%s]\n", fileName.c_str());
+            return false;
+        }
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t nameLength = 0;
+        if (!ReadValue(file, magic) || !ReadValue(file, version) || !ReadValue(file, outTrace.FileSize) ||
+            !ReadValue(file, nameLength) || magic != c_IOTraceMagic || version != c_IOTraceVersion ||
+            nameLength > 64 * 1024)
+        {
+            fprintf(stderr, "[%s] is not a version %u ACE IO trace\n", fileName.c_str(), c_IOTraceVersion);
+            fclose(file);
+            return false;
+        }
+        outTrace.FileName.resize(nameLength);
+        if (nameLength > 0 && fread(&outTrace.FileName[0], 1, nameLength, file) != nameLength)
+        {
+            fprintf(stderr, "[%s] is not a version %u ACE IO trace\n", fileName.c_str(), c_IOTraceVersion);
+            fclose(file);
+            return false;
+        }
+
+        while (true)
+        {
+            uint8_t opCode = 0;
+            if (!ReadValue(file, opCode))
+            {
+                break;
+            }
+            FTraceRecord record;
+            if (opCode >= c_NumOps || !ReadValue(file, record.SinceLastUs) || !ReadValue(file, record.DurationUs) ||
+                !ReadValue(file, record.Position) || !ReadValue(file, record.Size) || !ReadValue(file, record.Outcome))
+            {
+                // Most likely a trace cut short by a crash. Replay what was recorded so far
+                outTrace.IsTruncated = true;
+                break;
+            }
+            record.Op = static_cast<EOp>(opCode);
+            outTrace.Records.push_back(record);
+        }
+        fclose(file);
+        return true;
+    }
+
+    // Reads an ACE file the way one of the plugin's IO hooks would, counting what reaches the OS
+    class FReplayFile
+    {
+    public:
+        explicit FReplayFile(const FOptions& options) : m_Options(options)
+        {
+        }
+
+        ~FReplayFile()
+        {
+            Close();
+        }
+
+        bool Open(const std::string& fileName)
+        {
+            Close();
+            m_Fd = open(fileName.c_str(), O_RDONLY);
+            if (m_Fd < 0)
+            {
+                return false;
+            }
+            struct stat fileStat;
+            if (fstat(m_Fd, &fileStat) != 0)
+            {
+                Close();
+                return false;
+            }
+            m_FileSize = static_cast<uint64_t>(fileStat.st_size);
+
+            if (m_Options.UseMappedIO)
+            {
+                void* mapping = m_FileSize > 0 ? mmap(nullptr, m_FileSize, PROT_READ, MAP_PRIVATE, m_Fd, 0) : nullptr;
+                if (mapping == MAP_FAILED)
+                {
+                    Close();
+                    return false;
+                }
+                m_Mapping = static_cast<const uint8_t*>(mapping);
+            }
+            else
+            {
+                m_Cache.resize(m_Options.CacheSize);
+            }
+            m_CacheOffset = 0;
+            m_CacheBytes = 0;
+            m_Position = 0;
+            m_LastReadEnd = UINT64_MAX;
+            m_ReadAheadEnd = 0;
+            return true;
+        }
+
+        bool Close()
+        {
+            if (m_Fd < 0)
+            {
+                return false;
+            }
+            if (m_Mapping != nullptr)
+            {
+                munmap(const_cast<uint8_t*>(m_Mapping), m_FileSize);
+                m_Mapping = nullptr;
+            }
+            close(m_Fd);
+            m_Fd = -1;
+            return true;
+        }
+
+        void DropCache()
+        {
+#ifdef POSIX_FADV_DONTNEED
+            if (m_Fd >= 0)
+            {
+                posix_fadvise(m_Fd, 0, 0, POSIX_FADV_DONTNEED);
+            }
+#endif
+        }
+
+        bool Seek(uint64_t position)
+        {
+            if (m_Fd < 0 || position > m_FileSize)
+            {
+                return false;
+            }
+            m_Position = position;
+            return true;
+        }
+
+        uint64_t Tell() const
+        {
+            return m_Position;
+        }
+
+        uint64_t Read(uint8_t* dest, uint64_t size)
+        {
+            if (m_Fd < 0 || m_Position >= m_FileSize)
+            {
+                return 0;
+            }
+            size = std::min(size, m_FileSize - m_Position);
+            const bool isSequential = m_Position == m_LastReadEnd;
+
+            uint64_t bytesRead = 0;
+            if (m_Mapping != nullptr)
+            {
+                memcpy(dest, m_Mapping + m_Position, size);
+                bytesRead = size;
+            }
+            else
+            {
+                bytesRead = ReadThroughCache(dest, size);
+            }
+
+            m_Position += bytesRead;
+            m_LastReadEnd = m_Position;
+            if (isSequential)
+            {
+                HintReadAhead();
+            }
+            return bytesRead;
+        }
+
+        uint64_t GetFileSize() const
+        {
+            return m_FileSize;
+        }
+
+        // Reads that went to the OS, and the bytes they asked for. Mapped reads fault pages in instead, so these
+        // stay at zero for them
+        uint64_t NumSystemReads = 0;
+        uint64_t SystemBytesRead = 0;
+
+    private:
+        uint64_t SystemRead(uint8_t* dest, uint64_t offset, uint64_t size)
+        {
+            uint64_t done = 0;
+            while (done < size)
+            {
+                const ssize_t result = pread(m_Fd, dest + done, size - done, static_cast<off_t>(offset + done));
+                NumSystemReads++;
+                if (result <= 0)
+                {
+                    break;
+                }
+                done += static_cast<uint64_t>(result);
+            }
+            SystemBytesRead += done;
+            return done;
+        }
+
+        uint64_t ReadThroughCache(uint8_t* dest, uint64_t size)
+        {
+            // Larger than the cache: no point copying it through
+            if (size >= m_Cache.size())
+            {
+                return SystemRead(dest, m_Position, size);
+            }
+
+            uint64_t done = 0;
+            while (done < size)
+            {
+                const uint64_t offset = m_Position + done;
+                if (offset < m_CacheOffset || offset >= m_CacheOffset + m_CacheBytes)
+                {
+                    m_CacheOffset = offset;
+                    const uint64_t blockSize = std::min<uint64_t>(m_Cache.size(), m_FileSize - offset);
+                    m_CacheBytes = SystemRead(m_Cache.data(), offset, blockSize);
+                    if (m_CacheBytes == 0)
+                    {
+                        break;
+                    }
+                }
+                const uint64_t fromCache = std::min(size - done, m_CacheOffset + m_CacheBytes - offset);
+                memcpy(dest + done, m_Cache.data() + (offset - m_CacheOffset), fromCache);
+                done += fromCache;
+            }
+            return done;
+        }
+
+        // Ask the OS to start reading past the current position in the background, as the plugin's read-ahead does
+        void HintReadAhead()
+        {
+            if (m_Options.ReadAheadSize == 0 || m_Position >= m_FileSize)
+            {
+                return;
+            }
+            const uint64_t start = std::max(m_Position, m_ReadAheadEnd);
+            const uint64_t end = std::min(m_Position + m_Options.ReadAheadSize, m_FileSize);
+            if (start >= end)
+            {
+                return;
+            }
+            if (m_Mapping != nullptr)
+            {
+                const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+                const uint64_t alignedStart = start & ~(pageSize - 1);
+                madvise(const_cast<uint8_t*>(m_Mapping) + alignedStart, end - alignedStart, MADV_WILLNEED);
+            }
+#ifdef POSIX_FADV_WILLNEED
+            else
+            {
+                posix_fadvise(m_Fd, static_cast<off_t>(start), static_cast<off_t>(end - start), POSIX_FADV_WILLNEED);
+            }
+#endif
+            m_ReadAheadEnd = end;
+        }
+
+        const FOptions& m_Options;
+        int m_Fd = -1;
+        uint64_t m_FileSize = 0;
+        uint64_t m_Position = 0;
+        const uint8_t* m_Mapping = nullptr;
+        std::vector<uint8_t> m_Cache;
+        uint64_t m_CacheOffset = 0;
+        uint64_t m_CacheBytes = 0;
+        uint64_t m_LastReadEnd = UINT64_MAX;
+        uint64_t m_ReadAheadEnd = 0;
+    };
+
+    // Latencies in microseconds, bucketed by powers of two for the histogram and kept whole for percentiles
+    class FLatencies
+    {
+    public:
+        static constexpr int c_NumBuckets = 24;
+
+        void Add(double microseconds)
+        {
+            m_Samples.push_back(microseconds);
+            int bucket = 0;
+            while (bucket < c_NumBuckets - 1 && microseconds >= static_cast<double>(1u << bucket))
+            {
+                bucket++;
+            }
+            m_Buckets[bucket]++;
+        }
+
+        size_t Count() const
+        {
+            return m_Samples.size();
+        }
+
+        double Total() const
+        {
+            double total = 0.0;
+            for (double sample : m_Samples)
+            {
+                total += sample;
+            }
+            return total;
+        }
+
+        double Percentile(double fraction)
+        {
+            if (m_Samples.empty())
+            {
+                return 0.0;
+            }
+            if (!m_IsSorted)
+            {
+                std::sort(m_Samples.begin(), m_Samples.end());
+                m_IsSorted = true;
+            }
+            const size_t index = std::min(
+                m_Samples.size() - 1, static_cast<size_t>(fraction * static_cast<double>(m_Samples.size())));
+            return m_Samples[index];
+        }
+
+        const uint64_t* GetBuckets() const
+        {
+            return m_Buckets;
+        }
+
+    private:
+        std::vector<double> m_Samples;
+        // Bucket 0 is under 1 us, bucket i covers [2^(i-1), 2^i) us, and the last bucket holds everything above
+        uint64_t m_Buckets[c_NumBuckets] = {};
+        bool m_IsSorted = false;
+    };
+
+    struct FOpStats
+    {
+        FLatencies Recorded;
+        FLatencies Replayed;
+        uint64_t Mismatches = 0;
+    };
+
+    void PrintHistogram(FOpStats& stats)
+    {
+        const uint64_t* recorded = stats.Recorded.GetBuckets();
+        const uint64_t* replayed = stats.Replayed.GetBuckets();
+        int first = FLatencies::c_NumBuckets;
+        int last = -1;
+        for (int i = 0; i < FLatencies::c_NumBuckets; i++)
+        {
+            if (recorded[i] != 0 || replayed[i] != 0)
+            {
+                first = std::min(first, i);
+                last = i;
+            }
+        }
+
+        printf("      latency           recorded   replayed\n");
+        for (int i = first; i <= last; i++)
+        {
+            char label[32];
+            if (i == 0)
+            {
+                snprintf(label, sizeof(label), "< 1 us");
+            }
+            else if (i == 1)
+            {
+                snprintf(label, sizeof(label), "1 us");
+            }
+            else if (i == FLatencies::c_NumBuckets - 1)
+            {
+                snprintf(label, sizeof(label), ">= %u us", 1u << (i - 1));
+            }
+            else
+            {
+                snprintf(label, sizeof(label), "%u-%u us", 1u << (i - 1), (1u << i) - 1);
+            }
+            printf("      %-16s %9" PRIu64 "  %9" PRIu64 "\n", label, recorded[i], replayed[i]);
+        }
+    }
+
+    void Replay(const FOptions& options, const FTrace& trace, const std::string& aceFileName, int pass)
+    {
+        FReplayFile file(options);
+        // The recorder wraps a hook that is already open, so traces usually start with reads. Open the file up
+        // front for those, which also reports a missing file before anything is replayed
+        if (!file.Open(aceFileName))
+        {
+            fprintf(stderr, "Failed to open traced ACE file for replay: [%s]\n", aceFileName.c_str());
+            return;
+        }
+        if (static_cast<int64_t>(file.GetFileSize()) != trace.FileSize)
+        {
+            fprintf(
+                stderr,
+                "ACE file [%s] is %" PRIu64 " bytes, but was %" PRId64 " bytes when traced. Timings may not compare\n",
+                aceFileName.c_str(),
+                file.GetFileSize(),
+                trace.FileSize);
+        }
+        if (options.DropCache)
+        {
+            file.DropCache();
+        }
+
+        FOpStats stats[c_NumOps];
+        std::vector<uint8_t> buffer;
+        uint64_t bytesRead = 0;
+        double busySeconds = 0.0;
+
+        const FClock::time_point replayStart = FClock::now();
+        FClock::time_point lastStart = replayStart;
+        for (const FTraceRecord& record : trace.Records)
+        {
+            if (options.IsPaced)
+            {
+                const FClock::time_point due = lastStart + std::chrono::microseconds(record.SinceLastUs);
+                if (due > FClock::now())
+                {
+                    std::this_thread::sleep_until(due);
+                }
+            }
+
+            const FClock::time_point start = FClock::now();
+            uint64_t result = 0;
+            switch (record.Op)
+            {
+                case EOp::OpenForRead:
+                    result = file.Open(aceFileName) ? 1 : 0;
+                    break;
+                case EOp::Read:
+                    // Reads are recorded with where they started. Only seek if the replay has drifted from that,
+                    // since the recorded seeks are replayed as their own records
+                    if (file.Tell() != record.Position)
+                    {
+                        file.Seek(record.Position);
+                    }
+                    if (buffer.size() < record.Size)
+                    {
+                        buffer.resize(record.Size);
+                    }
+                    result = file.Read(buffer.data(), record.Size);
+                    bytesRead += result;
+                    break;
+                case EOp::Seek:
+                    result = file.Seek(record.Position) ? 1 : 0;
+                    break;
+                case EOp::Close:
+                    result = file.Close() ? 1 : 0;
+                    break;
+            }
+            const double seconds = SecondsSince(start);
+            busySeconds += seconds;
+
+            FOpStats& opStats = stats[static_cast<int>(record.Op)];
+            opStats.Recorded.Add(static_cast<double>(record.DurationUs));
+            opStats.Replayed.Add(seconds * 1.0e6);
+            opStats.Mismatches += result != record.Outcome ? 1 : 0;
+            lastStart = start;
+        }
+        const double wallSeconds = SecondsSince(replayStart);
+
+        FOpStats& reads = stats[static_cast<int>(EOp::Read)];
+        const double recordedReadSeconds = reads.Recorded.Total() * 1.0e-6;
+        const double replayedReadSeconds = reads.Replayed.Total() * 1.0e-6;
+        const double megabytes = static_cast<double>(bytesRead) / (1024.0 * 1024.0);
+
+        printf("Pass %d: %zu calls in %.3f s (%.3f s inside calls)%s\n",
+            pass,
+            trace.Records.size(),
+            wallSeconds,
+            busySeconds,
+            options.IsPaced ? ", paced as recorded" : "");
+        printf("  Read %.2f MB in %zu reads\n", megabytes, reads.Replayed.Count());
+        printf("  Throughput inside reads: recorded %.1f MB/s, replayed %.1f MB/s\n",
+            recordedReadSeconds > 0.0 ? megabytes / recordedReadSeconds : 0.0,
+            replayedReadSeconds > 0.0 ? megabytes / replayedReadSeconds : 0.0);
+        printf("  Throughput over the replay: %.1f MB/s\n", wallSeconds > 0.0 ? megabytes / wallSeconds : 0.0);
+        printf("  IOPS inside reads: recorded %.0f, replayed %.0f\n",
+            recordedReadSeconds > 0.0 ? reads.Recorded.Count() / recordedReadSeconds : 0.0,
+            replayedReadSeconds > 0.0 ? reads.Replayed.Count() / replayedReadSeconds : 0.0);
+        if (!options.UseMappedIO)
+        {
+            printf("  OS reads: %" PRIu64 " calls, %.2f MB (%.0f IOPS over the replay)\n",
+                file.NumSystemReads,
+                static_cast<double>(file.SystemBytesRead) / (1024.0 * 1024.0),
+                wallSeconds > 0.0 ? file.NumSystemReads / wallSeconds : 0.0);
+        }
+
+        for (int op = 0; op < c_NumOps; op++)
+        {
+            FOpStats& opStats = stats[op];
+            if (opStats.Replayed.Count() == 0)
+            {
+                continue;
+            }
+            printf("  %s: %zu calls, %" PRIu64 " with a different outcome\n",
+                c_OpNames[op],
+                opStats.Replayed.Count(),
+                opStats.Mismatches);
+            printf("      us                p50        p90        p99        max      total\n");
+            printf("      recorded   %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                opStats.Recorded.Percentile(0.5),
+                opStats.Recorded.Percentile(0.9),
+                opStats.Recorded.Percentile(0.99),
+                opStats.Recorded.Percentile(1.0),
+                opStats.Recorded.Total());
+            printf("      replayed   %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                opStats.Replayed.Percentile(0.5),
+                opStats.Replayed.Percentile(0.9),
+                opStats.Replayed.Percentile(0.99),
+                opStats.Replayed.Percentile(1.0),
+                opStats.Replayed.Total());
+            PrintHistogram(opStats);
+        }
+    }
+
+    bool ParseSize(const char* text, uint64_t& outSize)
+    {
+        char* end = nullptr;
+        const unsigned long long value = strtoull(text, &end, 10);
+        if (end == text)
+        {
+            return false;
+        }
+        uint64_t scale = 1;
+        switch (*end)
+        {
+            case '\0':
+                break;
+            case 'k':
+            case 'K':
+                scale = 1024;
+                end++;
+                break;
+            case 'm':
+            case 'M':
+                scale = 1024 * 1024;
+                end++;
+                break;
+            case 'g':
+            case 'G':
+                scale = 1024 * 1024 * 1024;
+                end++;
+                break;
+            default:
+                return false;
+        }
+        outSize = static_cast<uint64_t>(value) * scale;
+        return *end == '\0';
+    }
+
+    void PrintUsage()
+    {
+        fprintf(
+            stderr,
+            "Usage: AceIOTraceReplay <trace file> [--ace <file>] [--io pread|mmap] [--cache-size <bytes>]\n"
+            "                        [--read-ahead <bytes>] [--paced] [--drop-cache] [--repeat <n>]\n");
+    }
+
+    bool ParseOptions(int argc, char** argv, FOptions& outOptions)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (arg == "--ace" && hasValue)
+            {
+                outOptions.AceFileName = argv[++i];
+            }
+            else if (arg == "--io" && hasValue)
+            {
+                const std::string io = argv[++i];
+                if (io != "pread" && io != "mmap")
+                {
+                    return false;
+                }
+                outOptions.UseMappedIO = io == "mmap";
+            }
+            else if (arg == "--cache-size" && hasValue)
+            {
+                if (!ParseSize(argv[++i], outOptions.CacheSize))
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--read-ahead" && hasValue)
+            {
+                if (!ParseSize(argv[++i], outOptions.ReadAheadSize))
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--repeat" && hasValue)
+            {
+                outOptions.Repeat = atoi(argv[++i]);
+                if (outOptions.Repeat < 1)
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--paced")
+            {
+                outOptions.IsPaced = true;
+            }
+            else if (arg == "--drop-cache")
+            {
+                outOptions.DropCache = true;
+            }
+            else if (!arg.empty() && arg[0] != '-' && outOptions.TraceFileName.empty())
+            {
+                outOptions.TraceFileName = arg;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return !outOptions.TraceFileName.empty();
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    FOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    FTrace trace;
+    if (!LoadTrace(options.TraceFileName, trace))
+    {
+        return 1;
+    }
+    if (trace.IsTruncated)
+    {
+        fprintf(stderr, "ACE IO trace [%s] is truncated. Replaying what was recorded\n", options.TraceFileName.c_str());
+    }
+
+    const std::string aceFileName = options.AceFileName.empty() ? trace.FileName : options.AceFileName;
+    if (options.UseMappedIO)
+    {
+        printf("Replaying [%s] against [%s], memory-mapped", options.TraceFileName.c_str(), aceFileName.c_str());
+    }
+    else
+    {
+        printf("Replaying [%s] against [%s], pread with a %" PRIu64 " KB cache",
+            options.TraceFileName.c_str(),
+            aceFileName.c_str(),
+            options.CacheSize / 1024);
+    }
+    printf(", read-ahead %" PRIu64 " KB\n", options.ReadAheadSize / 1024);
+
+    for (int pass = 1; pass <= options.Repeat; pass++)
+    {
+        Replay(options, trace, aceFileName, pass);
+    }
+    return 0;
+}